@@ -58,6 +58,31 @@ namespace Helpers
             std::cout << "==================================\n";
         }
 
+        static std::uint64_t constructed_count()
+        {
+            return id_seed;
+        }
+
+        static std::uint64_t copy_constructed_count()
+        {
+            return copy_constructor_count;
+        }
+
+        static std::uint64_t move_constructed_count()
+        {
+            return move_constructor_count;
+        }
+
+        static std::uint64_t copy_assigned_count()
+        {
+            return copy_assignment_count;
+        }
+
+        static std::uint64_t move_assigned_count()
+        {
+            return move_assignment_count;
+        }
+
         static void clear_stats()
         {
             id_seed = 0;
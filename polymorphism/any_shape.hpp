@@ -0,0 +1,157 @@
+#ifndef ANY_SHAPE_HPP
+#define ANY_SHAPE_HPP
+
+#include "shape.hpp"
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace Drawing
+{
+    template <typename T>
+    concept ShapeLike = std::copy_constructible<T> && std::is_nothrow_move_constructible_v<T>
+        && requires(T& shape, const T& const_shape, RenderSink& sink, int d) {
+               shape.move(d, d);
+               const_shape.draw(sink);
+           };
+
+    // Type-erased shape with value semantics - any ShapeLike type that fits in inline buffer
+    // - object is stored inside AnyShape (no heap allocation) - std::vector<AnyShape> is contiguous
+    // - calls are dispatched through a static table of function pointers - one table per stored type
+    // - set of types is open (unlike std::variant) - stored type does not have to derive from Shape
+    class AnyShape
+    {
+    public:
+        // buffer fits each of the existing shapes
+        static constexpr size_t buffer_size = std::max({sizeof(Circle), sizeof(Rectangle), sizeof(Line), sizeof(Square)});
+        static constexpr size_t buffer_alignment = std::max({alignof(Circle), alignof(Rectangle), alignof(Line), alignof(Square)});
+
+        template <typename T>
+            requires(!std::same_as<std::remove_cvref_t<T>, AnyShape> && ShapeLike<std::remove_cvref_t<T>>)
+        AnyShape(T&& shape)
+            : AnyShape(std::in_place_type<std::remove_cvref_t<T>>, std::forward<T>(shape))
+        {
+        }
+
+        template <ShapeLike T, typename... TArgs>
+        explicit AnyShape(std::in_place_type_t<T>, TArgs&&... args)
+            : table_{&dispatch_table<T>}
+        {
+            static_assert(sizeof(T) <= buffer_size && alignof(T) <= buffer_alignment, "Shape does not fit in buffer of AnyShape");
+            std::construct_at(reinterpret_cast<T*>(buffer_), std::forward<TArgs>(args)...);
+        }
+
+        AnyShape(const AnyShape& source)
+            : table_{source.table_}
+        {
+            table_->copy(source.buffer_, buffer_);
+        }
+
+        // source keeps a moved-from shape
+        AnyShape(AnyShape&& source) noexcept
+            : table_{source.table_}
+        {
+            table_->move(source.buffer_, buffer_);
+        }
+
+        AnyShape& operator=(const AnyShape& source)
+        {
+            if (this != &source) // avoiding self assignment
+            {
+                AnyShape temp(source);
+                *this = std::move(temp);
+            }
+
+            return *this;
+        }
+
+        AnyShape& operator=(AnyShape&& source) noexcept
+        {
+            if (this != &source) // avoiding self assignment
+            {
+                table_->destroy(buffer_);
+                table_ = source.table_;
+                table_->move(source.buffer_, buffer_);
+            }
+
+            return *this;
+        }
+
+        ~AnyShape()
+        {
+            table_->destroy(buffer_);
+        }
+
+        void move(int dx, int dy)
+        {
+            table_->move_by(buffer_, dx, dy);
+        }
+
+        // writes description of shape to std::cout (stream is not flushed)
+        void draw() const
+        {
+            TextRenderSink& sink = cout_render_sink();
+            draw(sink);
+            sink.flush();
+        }
+
+        void draw(RenderSink& sink) const
+        {
+            table_->draw(buffer_, sink);
+        }
+
+        // pointer to stored shape if it is of type T - otherwise nullptr
+        template <typename T>
+        T* target() noexcept
+        {
+            return table_ == &dispatch_table<T> ? stored<T>(buffer_) : nullptr;
+        }
+
+        template <typename T>
+        const T* target() const noexcept
+        {
+            return table_ == &dispatch_table<T> ? stored<T>(buffer_) : nullptr;
+        }
+
+    private:
+        struct DispatchTable
+        {
+            void (*move_by)(void* shape, int dx, int dy);
+            void (*draw)(const void* shape, RenderSink& sink);
+            void (*copy)(const void* source, void* target);
+            void (*move)(void* source, void* target) noexcept;
+            void (*destroy)(void* shape) noexcept;
+        };
+
+        template <typename T>
+        static T* stored(void* buffer) noexcept
+        {
+            return std::launder(static_cast<T*>(buffer));
+        }
+
+        template <typename T>
+        static const T* stored(const void* buffer) noexcept
+        {
+            return std::launder(static_cast<const T*>(buffer));
+        }
+
+        // stored object is exactly T - qualified T::move calls the final overrider of Shape::move() directly (no virtual dispatch)
+        template <typename T>
+        static constexpr DispatchTable dispatch_table{
+            [](void* shape, int dx, int dy) { stored<T>(shape)->T::move(dx, dy); },
+            [](const void* shape, RenderSink& sink) { stored<T>(shape)->draw(sink); },
+            [](const void* source, void* target) { std::construct_at(static_cast<T*>(target), *stored<T>(source)); },
+            [](void* source, void* target) noexcept { std::construct_at(static_cast<T*>(target), std::move(*stored<T>(source))); },
+            [](void* shape) noexcept { std::destroy_at(stored<T>(shape)); }};
+
+        const DispatchTable* table_;
+        alignas(buffer_alignment) std::byte buffer_[buffer_size];
+    };
+} // namespace Drawing
+
+#endif // ANY_SHAPE_HPP
@@ -0,0 +1,136 @@
+#include "any_shape.hpp"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <variant>
+#include <vector>
+
+namespace
+{
+    // runs pass over shapes repeatedly for at least 200ms and prints number of shapes processed per second
+    template <typename Pass>
+    void report_shapes_per_second(const std::string& name, size_t shapes_per_pass, Pass pass)
+    {
+        using namespace std::chrono;
+
+        size_t passes = 0;
+        const auto start = steady_clock::now();
+        auto elapsed = steady_clock::duration{};
+        do
+        {
+            pass();
+            ++passes;
+            elapsed = steady_clock::now() - start;
+        } while (elapsed < 200ms);
+
+        const double seconds = duration<double>(elapsed).count();
+        std::cout << std::left << std::setw(48) << name << std::fixed << std::setprecision(2)
+                  << (static_cast<double>(shapes_per_pass) * passes / seconds / 1e6) << " M shapes/s\n";
+    }
+
+    // calls add for each shape of a scene - types are shuffled, so dispatch is not predictable
+    template <typename Add>
+    void build_scene(size_t n, Add add)
+    {
+        using namespace Drawing;
+
+        std::mt19937 rnd{42};
+        std::uniform_int_distribution<int> kind{0, 3};
+
+        for (int i = 0; i < static_cast<int>(n); ++i)
+        {
+            switch (kind(rnd))
+            {
+            case 0:
+                add(Circle{i, -i, 10});
+                break;
+            case 1:
+                add(Rectangle{i, -i, 10, 20});
+                break;
+            case 2:
+                add(Line{i, -i, i + 10, i + 10});
+                break;
+            default:
+                add(Square{i, -i, 10});
+            }
+        }
+    }
+} // namespace
+
+TEST_CASE("AnyShape vs virtual vs variant - 1M shapes", "[AnyShape]")
+{
+    using namespace Drawing;
+
+    constexpr size_t n = 1'000'000;
+
+    std::vector<std::unique_ptr<Shape>> virtual_shapes;
+    virtual_shapes.reserve(n);
+    build_scene(n, [&](auto shape) { virtual_shapes.push_back(std::make_unique<decltype(shape)>(shape)); });
+
+    using ShapeVariant = std::variant<Circle, Rectangle, Line, Square>;
+    std::vector<ShapeVariant> variant_shapes;
+    variant_shapes.reserve(n);
+    build_scene(n, [&](auto shape) { variant_shapes.emplace_back(shape); });
+
+    std::vector<AnyShape> any_shapes;
+    any_shapes.reserve(n);
+    build_scene(n, [&](auto shape) { any_shapes.push_back(shape); });
+
+    report_shapes_per_second("build - vector<unique_ptr<Shape>>", n, [&] {
+        virtual_shapes.clear();
+        build_scene(n, [&](auto shape) { virtual_shapes.push_back(std::make_unique<decltype(shape)>(shape)); });
+    });
+
+    report_shapes_per_second("build - vector<variant>", n, [&] {
+        variant_shapes.clear();
+        build_scene(n, [&](auto shape) { variant_shapes.emplace_back(shape); });
+    });
+
+    report_shapes_per_second("build - vector<AnyShape>", n, [&] {
+        any_shapes.clear();
+        build_scene(n, [&](auto shape) { any_shapes.push_back(shape); });
+    });
+
+    std::cout << "sizeof(AnyShape): " << sizeof(AnyShape) << "; sizeof(std::variant): " << sizeof(ShapeVariant) << "\n";
+
+    report_shapes_per_second("move - vector<unique_ptr<Shape>>", n, [&] {
+        for (const auto& shape : virtual_shapes)
+            shape->move(1, 1);
+    });
+
+    report_shapes_per_second("move - vector<variant>", n, [&] {
+        for (auto& shape : variant_shapes)
+            std::visit([](auto& s) { s.move(1, 1); }, shape);
+    });
+
+    report_shapes_per_second("move - vector<AnyShape>", n, [&] {
+        for (auto& shape : any_shapes)
+            shape.move(1, 1);
+    });
+
+    RenderCommandBuffer commands;
+
+    report_shapes_per_second("draw - vector<unique_ptr<Shape>>", n, [&] {
+        commands.clear();
+        for (const auto& shape : virtual_shapes)
+            shape->draw(commands);
+    });
+
+    report_shapes_per_second("draw - vector<variant>", n, [&] {
+        commands.clear();
+        for (const auto& shape : variant_shapes)
+            std::visit([&](const auto& s) { s.draw(commands); }, shape);
+    });
+
+    report_shapes_per_second("draw - vector<AnyShape>", n, [&] {
+        commands.clear();
+        for (const auto& shape : any_shapes)
+            shape.draw(commands);
+    });
+}
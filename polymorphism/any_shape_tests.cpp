@@ -0,0 +1,138 @@
+#include "any_shape.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace Drawing;
+
+namespace
+{
+    // shape that is not derived from Shape
+    struct Dot
+    {
+        Point position;
+
+        void move(int dx, int dy)
+        {
+            position.translate(dx, dy);
+        }
+
+        void draw(RenderSink& sink) const
+        {
+            sink.circle(position, 1);
+        }
+    };
+
+    std::string description(const AnyShape& shape)
+    {
+        std::ostringstream out;
+        {
+            TextRenderSink sink{out};
+            shape.draw(sink);
+        }
+        return out.str();
+    }
+
+    // string buffer counting flushes of the stream using it
+    class SyncCountingBuffer : public std::stringbuf
+    {
+    public:
+        int syncs{};
+
+    protected:
+        int sync() override
+        {
+            ++syncs;
+            return std::stringbuf::sync();
+        }
+    };
+} // namespace
+
+TEST_CASE("AnyShape")
+{
+    static_assert(sizeof(AnyShape) == sizeof(void*) + AnyShape::buffer_size);
+
+    AnyShape shape = Circle{10, 20, 5};
+
+    CHECK(description(shape) == "Drawing Circle at Point{10, 20} with radius 5\n");
+    REQUIRE(shape.target<Circle>() != nullptr);
+    CHECK(shape.target<Circle>()->radius() == 5);
+    CHECK(shape.target<Rectangle>() == nullptr);
+
+    SECTION("move")
+    {
+        shape.move(1, 2);
+        CHECK(description(shape) == "Drawing Circle at Point{11, 22} with radius 5\n");
+    }
+
+    SECTION("stores shape not derived from Shape")
+    {
+        shape = Dot{{1, 2}};
+        shape.move(1, 1);
+        CHECK(description(shape) == "Drawing Circle at Point{2, 3} with radius 1\n");
+        CHECK(shape.target<Dot>() != nullptr);
+        CHECK(shape.target<Circle>() == nullptr);
+    }
+
+    SECTION("copy is independent")
+    {
+        AnyShape copy = shape;
+        copy.move(1, 1);
+        CHECK(description(shape) == "Drawing Circle at Point{10, 20} with radius 5\n");
+        CHECK(description(copy) == "Drawing Circle at Point{11, 21} with radius 5\n");
+
+        AnyShape line = Line{1, 2, 3, 4};
+        line = copy;
+        CHECK(description(line) == "Drawing Circle at Point{11, 21} with radius 5\n");
+    }
+
+    SECTION("draw() writes to std::cout without flushing it")
+    {
+        SyncCountingBuffer out;
+        std::streambuf* const previous = std::cout.rdbuf(&out);
+        shape.draw();
+        AnyShape{Line{1, 2, 3, 4}}.draw();
+        std::cout.rdbuf(previous);
+
+        CHECK(out.str()
+            == "Drawing Circle at Point{10, 20} with radius 5\n"
+               "Drawing Line from Point{1, 2} to Point{3, 4}\n");
+        CHECK(out.syncs == 0);
+    }
+
+    SECTION("move assignment changes stored type")
+    {
+        AnyShape square{std::in_place_type<Square>, 1, 2, 3};
+        shape = std::move(square);
+        CHECK(shape.target<Square>() != nullptr);
+        CHECK(description(shape) == "Drawing Rectangle at Point{1, 2} with dimensions (width: 3, height: 3)\n");
+    }
+}
+
+TEST_CASE("AnyShape - shapes stored contiguously in vector")
+{
+    std::vector<AnyShape> shapes;
+    shapes.push_back(Circle{1, 2, 3});
+    shapes.push_back(Rectangle{4, 5, 6, 7});
+    shapes.emplace_back(std::in_place_type<Line>, 0, 0, 8, 9);
+    shapes.push_back(Dot{{3, 3}});
+
+    CHECK(reinterpret_cast<std::byte*>(&shapes[3]) - reinterpret_cast<std::byte*>(&shapes[0]) == 3 * sizeof(AnyShape));
+
+    std::ostringstream out;
+    {
+        TextRenderSink sink{out};
+        for (const auto& shape : shapes)
+            shape.draw(sink);
+    }
+
+    CHECK(out.str()
+        == "Drawing Circle at Point{1, 2} with radius 3\n"
+           "Drawing Rectangle at Point{4, 5} with dimensions (width: 6, height: 7)\n"
+           "Drawing Line from Point{0, 0} to Point{8, 9}\n"
+           "Drawing Circle at Point{3, 3} with radius 1\n");
+}
@@ -21,6 +21,27 @@ namespace Drawing
             return out;
         }
     };
+
+    // axis-aligned box - min & max corners are included
+    struct Box
+    {
+        Point min, max;
+
+        bool contains(const Point& pt) const
+        {
+            return min.x <= pt.x && pt.x <= max.x && min.y <= pt.y && pt.y <= max.y;
+        }
+
+        bool intersects(const Box& other) const
+        {
+            return min.x <= other.max.x && other.min.x <= max.x && min.y <= other.max.y && other.min.y <= max.y;
+        }
+
+        friend bool operator==(const Box& a, const Box& b)
+        {
+            return a.min.x == b.min.x && a.min.y == b.min.y && a.max.x == b.max.x && a.max.y == b.max.y;
+        }
+    };
 } // namespace Drawing
 
 #endif // POINT_HPP
\ No newline at end of file
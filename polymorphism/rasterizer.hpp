@@ -0,0 +1,346 @@
+#ifndef RASTERIZER_HPP
+#define RASTERIZER_HPP
+
+#include "../vector/numeric_vector.hpp"
+#include "render_sink.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Drawing
+{
+    // pixel with bytes R, G, B, A in memory order
+    constexpr uint32_t rgba(uint8_t r, uint8_t g, uint8_t b, uint8_t a = 255) noexcept
+    {
+        return std::bit_cast<uint32_t>(std::array<uint8_t, 4>{r, g, b, a});
+    }
+
+    // RGBA image - rows are stored one after another
+    class Framebuffer
+    {
+    public:
+        Framebuffer(int width, int height, uint32_t background = rgba(0, 0, 0))
+            : width_{width}
+            , height_{height}
+            , pixels_(checked_area(width, height))
+        {
+            clear(background);
+        }
+
+        int width() const noexcept
+        {
+            return width_;
+        }
+
+        int height() const noexcept
+        {
+            return height_;
+        }
+
+        uint32_t pixel(int x, int y) const noexcept
+        {
+            return pixels_[index(x, y)];
+        }
+
+        const uint32_t* data() const noexcept
+        {
+            return pixels_.begin();
+        }
+
+        void clear(uint32_t color)
+        {
+            ModernCpp::Simd::fill(pixels_.begin(), color, pixels_.size());
+        }
+
+        void set_pixel(int x, int y, uint32_t color) noexcept
+        {
+            pixels_[index(x, y)] = color;
+        }
+
+        // fills pixels [first_x, last_x] of row y - span must lie inside of framebuffer
+        void fill_span(int y, int first_x, int last_x, uint32_t color) noexcept
+        {
+            ModernCpp::Simd::fill(pixels_.begin() + index(first_x, y), color, static_cast<size_t>(last_x - first_x + 1));
+        }
+
+        // FNV-1a over bytes of pixels
+        uint64_t hash() const noexcept
+        {
+            uint64_t hash = 14695981039346656037ull;
+            for (const uint32_t pixel : pixels_)
+                for (const uint8_t byte : std::bit_cast<std::array<uint8_t, 4>>(pixel))
+                    hash = (hash ^ byte) * 1099511628211ull;
+            return hash;
+        }
+
+        // binary PPM (P6) - alpha is dropped
+        void write_ppm(std::ostream& out) const
+        {
+            out << "P6\n" << width_ << " " << height_ << "\n255\n";
+
+            std::string row(static_cast<size_t>(width_) * 3, '\0');
+            for (int y = 0; y < height_; ++y)
+            {
+                for (int x = 0; x < width_; ++x)
+                {
+                    const auto bytes = std::bit_cast<std::array<char, 4>>(pixel(x, y));
+                    std::copy_n(bytes.begin(), 3, row.begin() + x * 3);
+                }
+                out.write(row.data(), static_cast<std::streamsize>(row.size()));
+            }
+        }
+
+    private:
+        int width_, height_;
+        ModernCpp::NumericVector<uint32_t> pixels_;
+
+        static size_t checked_area(int width, int height)
+        {
+            if (width <= 0 || height <= 0)
+                throw std::invalid_argument{"invalid size of framebuffer"};
+            return static_cast<size_t>(width) * height;
+        }
+
+        size_t index(int x, int y) const noexcept
+        {
+            return static_cast<size_t>(y) * width_ + x;
+        }
+    };
+
+    // Software rasterizer - collects shapes drawn into it & renders them into a framebuffer
+    // - rectangles & circles are filled scanline by scanline, lines are drawn with Bresenham's algorithm
+    // - screen is split into square tiles rasterized in parallel; each tile draws only shapes binned to it
+    // - shapes are drawn in order of submission within every tile, so result does not depend on number of threads
+    class Rasterizer : public RenderSink
+    {
+    public:
+        explicit Rasterizer(int tile_size = 64)
+            : tile_size_{tile_size}
+        {
+            if (tile_size <= 0)
+                throw std::invalid_argument{"invalid tile size of rasterizer"};
+        }
+
+        // color of shapes drawn after the call
+        void set_color(uint32_t color) noexcept
+        {
+            color_ = color;
+        }
+
+        void circle(Point center, uint16_t radius) override
+        {
+            primitives_.push_back(Primitive{Primitive::Kind::circle, color_, center, Point{radius, radius}});
+        }
+
+        // rectangle covers [corner, corner + (width, height)] - the same area as its bounding box
+        void rectangle(Point corner, uint16_t width, uint16_t height) override
+        {
+            primitives_.push_back(Primitive{Primitive::Kind::rectangle, color_, corner, Point{corner.x + width, corner.y + height}});
+        }
+
+        void line(Point start, Point end) override
+        {
+            primitives_.push_back(Primitive{Primitive::Kind::line, color_, start, end});
+        }
+
+        size_t size() const noexcept
+        {
+            return primitives_.size();
+        }
+
+        void clear() noexcept
+        {
+            primitives_.clear();
+        }
+
+        // draws collected shapes over content of target
+        void render(Framebuffer& target, size_t threads = std::max(1u, std::thread::hardware_concurrency()))
+        {
+            const int columns = (target.width() + tile_size_ - 1) / tile_size_;
+            const int rows = (target.height() + tile_size_ - 1) / tile_size_;
+            bin(target, columns, rows);
+
+            // tiles are taken one by one - cost of tiles differs a lot
+            std::atomic<size_t> next_tile{0};
+            const auto worker = [&] {
+                for (size_t tile = next_tile++; tile < bins_.size(); tile = next_tile++)
+                {
+                    const int column = static_cast<int>(tile % columns), row = static_cast<int>(tile / columns);
+                    const Box area{{column * tile_size_, row * tile_size_},
+                        {std::min((column + 1) * tile_size_, target.width()) - 1, std::min((row + 1) * tile_size_, target.height()) - 1}};
+
+                    for (const uint32_t id : bins_[tile])
+                        draw(primitives_[id], area, target);
+                }
+            };
+
+            const size_t helpers = std::clamp<size_t>(threads, 1, bins_.size()) - 1;
+            std::vector<std::jthread> workers; // joined on return
+            workers.reserve(helpers);
+            for (size_t i = 0; i < helpers; ++i)
+                workers.emplace_back(worker);
+
+            worker();
+        }
+
+    private:
+        struct Primitive
+        {
+            enum class Kind : uint8_t
+            {
+                circle,
+                rectangle,
+                line
+            };
+
+            Kind kind;
+            uint32_t color;
+            Point a, b; // circle: center & (radius, radius); rectangle: corners; line: ends
+
+            Box bounds() const noexcept
+            {
+                switch (kind)
+                {
+                case Kind::circle:
+                    return Box{{a.x - b.x, a.y - b.x}, {a.x + b.x, a.y + b.x}};
+                case Kind::rectangle:
+                    return Box{a, b};
+                default:
+                    return Box{{std::min(a.x, b.x), std::min(a.y, b.y)}, {std::max(a.x, b.x), std::max(a.y, b.y)}};
+                }
+            }
+        };
+
+        int tile_size_;
+        uint32_t color_ = rgba(255, 255, 255);
+        std::vector<Primitive> primitives_;
+        std::vector<std::vector<uint32_t>> bins_; // ids of primitives overlapping each tile (row-major) - kept between renders
+
+        void bin(const Framebuffer& target, int columns, int rows)
+        {
+            bins_.resize(static_cast<size_t>(columns) * rows);
+            for (auto& bin : bins_)
+                bin.clear();
+
+            const Box screen{{0, 0}, {target.width() - 1, target.height() - 1}};
+            for (size_t id = 0; id < primitives_.size(); ++id)
+            {
+                const Box box = primitives_[id].bounds();
+                if (!box.intersects(screen))
+                    continue;
+
+                const int first_column = std::max(box.min.x, 0) / tile_size_, last_column = std::min(box.max.x, screen.max.x) / tile_size_;
+                const int first_row = std::max(box.min.y, 0) / tile_size_, last_row = std::min(box.max.y, screen.max.y) / tile_size_;
+                for (int row = first_row; row <= last_row; ++row)
+                    for (int column = first_column; column <= last_column; ++column)
+                        bins_[static_cast<size_t>(row) * columns + column].push_back(static_cast<uint32_t>(id));
+            }
+        }
+
+        // draws part of primitive lying in area
+        static void draw(const Primitive& primitive, const Box& area, Framebuffer& target) noexcept
+        {
+            switch (primitive.kind)
+            {
+            case Primitive::Kind::circle:
+                fill_circle(primitive.a, primitive.b.x, primitive.color, area, target);
+                break;
+            case Primitive::Kind::rectangle:
+                fill_rectangle(primitive.a, primitive.b, primitive.color, area, target);
+                break;
+            case Primitive::Kind::line:
+                draw_line(primitive.a, primitive.b, primitive.color, area, target);
+                break;
+            }
+        }
+
+        static void fill_rectangle(Point first, Point last, uint32_t color, const Box& area, Framebuffer& target) noexcept
+        {
+            const int first_x = std::max(first.x, area.min.x), last_x = std::min(last.x, area.max.x);
+            if (first_x > last_x)
+                return;
+
+            for (int y = std::max(first.y, area.min.y); y <= std::min(last.y, area.max.y); ++y)
+                target.fill_span(y, first_x, last_x, color);
+        }
+
+        // pixels with (x - center.x)^2 + (y - center.y)^2 <= radius^2
+        static void fill_circle(Point center, int radius, uint32_t color, const Box& area, Framebuffer& target) noexcept
+        {
+            const int64_t radius_squared = static_cast<int64_t>(radius) * radius;
+            for (int y = std::max(center.y - radius, area.min.y); y <= std::min(center.y + radius, area.max.y); ++y)
+            {
+                const int dy = y - center.y;
+                const int half_width = isqrt(radius_squared - static_cast<int64_t>(dy) * dy);
+                const int first_x = std::max(center.x - half_width, area.min.x), last_x = std::min(center.x + half_width, area.max.x);
+                if (first_x <= last_x)
+                    target.fill_span(y, first_x, last_x, color);
+            }
+        }
+
+        // Bresenham's line clipped to area - the same pixels in every tile as for the whole line
+        // i-th pixel along major axis is offset by round(i * minor / major) on minor axis; state of the algorithm
+        // at the first step inside area is computed directly, so a tile does not walk the line from its start
+        static void draw_line(Point start, Point end, uint32_t color, const Box& area, Framebuffer& target) noexcept
+        {
+            const bool x_major = std::abs(end.x - start.x) >= std::abs(end.y - start.y);
+            const auto major = [=](Point pt) { return x_major ? pt.x : pt.y; };
+            const auto minor = [=](Point pt) { return x_major ? pt.y : pt.x; };
+
+            const int64_t major_delta = std::abs(major(end) - major(start)), minor_delta = std::abs(minor(end) - minor(start));
+            const int major_step = major(end) >= major(start) ? 1 : -1, minor_step = minor(end) >= minor(start) ? 1 : -1;
+
+            // steps whose major coordinate lies in area
+            const int area_first = major(area.min), area_last = major(area.max);
+            const int64_t to_first = major_step > 0 ? area_first - major(start) : major(start) - area_last;
+            const int64_t to_last = major_step > 0 ? area_last - major(start) : major(start) - area_first;
+            const int64_t first_step = std::max<int64_t>(to_first, 0), last_step = std::min(to_last, major_delta);
+            if (first_step > last_step)
+                return;
+
+            // minor offset = (2 * step * minor_delta + major_delta) / (2 * major_delta), remainder is error term
+            const int64_t denominator = 2 * std::max<int64_t>(major_delta, 1);
+            const int64_t numerator = 2 * first_step * minor_delta + major_delta;
+            int64_t minor_offset = numerator / denominator, error = numerator % denominator;
+
+            for (int64_t step = first_step; step <= last_step; ++step)
+            {
+                const int major_coord = major(start) + static_cast<int>(step) * major_step;
+                const int minor_coord = minor(start) + static_cast<int>(minor_offset) * minor_step;
+                const Point pt = x_major ? Point{major_coord, minor_coord} : Point{minor_coord, major_coord};
+                if (area.contains(pt))
+                    target.set_pixel(pt.x, pt.y, color);
+
+                error += 2 * minor_delta;
+                if (error >= denominator)
+                {
+                    error -= denominator;
+                    ++minor_offset;
+                }
+            }
+        }
+
+        static int isqrt(int64_t value) noexcept
+        {
+            auto root = static_cast<int64_t>(std::sqrt(static_cast<double>(value)));
+            while (root * root > value)
+                --root;
+            while ((root + 1) * (root + 1) <= value)
+                ++root;
+            return static_cast<int>(root);
+        }
+    };
+} // namespace Drawing
+
+#endif // RASTERIZER_HPP
@@ -0,0 +1,71 @@
+#include "rasterizer.hpp"
+#include "shape.hpp"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    // renders frame repeatedly for at least 200ms and prints pixels & shapes rendered per second
+    void report_render_rate(const std::string& name, Drawing::Rasterizer& rasterizer, Drawing::Framebuffer& frame, size_t threads)
+    {
+        using namespace std::chrono;
+
+        size_t frames = 0;
+        const auto start = steady_clock::now();
+        auto elapsed = steady_clock::duration{};
+        do
+        {
+            frame.clear(Drawing::rgba(0, 0, 0));
+            rasterizer.render(frame, threads);
+            ++frames;
+            elapsed = steady_clock::now() - start;
+        } while (elapsed < 200ms);
+
+        const double frames_per_second = frames / duration<double>(elapsed).count();
+        const double pixels = static_cast<double>(frame.width()) * frame.height();
+        std::cout << std::left << std::setw(40) << name << std::fixed << std::setprecision(1)
+                  << std::setw(8) << (pixels * frames_per_second / 1e6) << " MPixel/s; "
+                  << std::setw(8) << (static_cast<double>(rasterizer.size()) * frames_per_second / 1e6) << " M shapes/s\n";
+    }
+} // namespace
+
+TEST_CASE("Rasterizer - 1920x1080 frame", "[Rasterizer]")
+{
+    using namespace Drawing;
+
+    constexpr int width = 1920, height = 1080;
+
+    for (const int n : {10'000, 100'000})
+    {
+        std::mt19937 rnd{42};
+        std::uniform_int_distribution<int> x{0, width - 1}, y{0, height - 1};
+        std::uniform_int_distribution<int> size{1, 40};
+        std::uniform_int_distribution<uint32_t> color;
+
+        Rasterizer rasterizer{64};
+        for (int i = 0; i < n; ++i)
+        {
+            const int px = x(rnd), py = y(rnd);
+            rasterizer.set_color(color(rnd));
+            if (i % 3 == 0)
+                Circle{px, py, static_cast<uint16_t>(size(rnd))}.draw(rasterizer);
+            else if (i % 3 == 1)
+                Rectangle{px, py, static_cast<uint16_t>(size(rnd)), static_cast<uint16_t>(size(rnd))}.draw(rasterizer);
+            else
+                Line{px, py, px + 4 * size(rnd), py - 4 * size(rnd)}.draw(rasterizer);
+        }
+
+        Framebuffer frame{width, height};
+        for (size_t threads = 1; threads <= std::max(1u, std::thread::hardware_concurrency()); threads *= 2)
+            report_render_rate(std::to_string(n) + " shapes - " + std::to_string(threads) + " thread(s)", rasterizer, frame, threads);
+    }
+}
@@ -0,0 +1,240 @@
+#include "rasterizer.hpp"
+#include "shape.hpp"
+
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace Drawing;
+
+namespace
+{
+    constexpr uint32_t black = rgba(0, 0, 0);
+    constexpr uint32_t white = rgba(255, 255, 255);
+
+    size_t count_pixels(const Framebuffer& frame, uint32_t color)
+    {
+        size_t count = 0;
+        for (int y = 0; y < frame.height(); ++y)
+            for (int x = 0; x < frame.width(); ++x)
+                count += frame.pixel(x, y) == color;
+        return count;
+    }
+
+    // shapes drawn pixel by pixel from definitions - no tiles, no spans
+    class ReferenceSink : public RenderSink
+    {
+    public:
+        ReferenceSink(Framebuffer& frame, uint32_t color)
+            : frame_{frame}
+            , color_{color}
+        {
+        }
+
+        void circle(Point center, uint16_t radius) override
+        {
+            for (int y = center.y - radius; y <= center.y + radius; ++y)
+                for (int x = center.x - radius; x <= center.x + radius; ++x)
+                    if ((x - center.x) * (x - center.x) + (y - center.y) * (y - center.y) <= radius * radius)
+                        plot(x, y);
+        }
+
+        void rectangle(Point corner, uint16_t width, uint16_t height) override
+        {
+            for (int y = corner.y; y <= corner.y + height; ++y)
+                for (int x = corner.x; x <= corner.x + width; ++x)
+                    plot(x, y);
+        }
+
+        // pixel at step i along major axis is offset by round(i * minor / major), halves rounded up
+        void line(Point start, Point end) override
+        {
+            const int dx = end.x - start.x, dy = end.y - start.y;
+            const int major = std::max(std::abs(dx), std::abs(dy)), minor = std::min(std::abs(dx), std::abs(dy));
+            const int sx = dx >= 0 ? 1 : -1, sy = dy >= 0 ? 1 : -1;
+
+            for (int i = 0; i <= major; ++i)
+            {
+                const int offset = major == 0 ? 0 : (2 * i * minor + major) / (2 * major);
+                if (std::abs(dx) >= std::abs(dy))
+                    plot(start.x + i * sx, start.y + offset * sy);
+                else
+                    plot(start.x + offset * sx, start.y + i * sy);
+            }
+        }
+
+    private:
+        Framebuffer& frame_;
+        uint32_t color_;
+
+        void plot(int x, int y)
+        {
+            if (0 <= x && x < frame_.width() && 0 <= y && y < frame_.height())
+                frame_.set_pixel(x, y, color_);
+        }
+    };
+
+    // shapes partially or entirely outside of 200x150 frame
+    std::vector<std::unique_ptr<Shape>> make_scene(size_t n)
+    {
+        std::mt19937 rnd{2024};
+        std::uniform_int_distribution<int> coord{-50, 250};
+        std::uniform_int_distribution<int> size{0, 60};
+
+        std::vector<std::unique_ptr<Shape>> shapes;
+        for (size_t i = 0; i < n; ++i)
+        {
+            const int x = coord(rnd), y = coord(rnd);
+            switch (i % 4)
+            {
+            case 0:
+                shapes.push_back(std::make_unique<Circle>(x, y, size(rnd)));
+                break;
+            case 1:
+                shapes.push_back(std::make_unique<Rectangle>(x, y, size(rnd), size(rnd)));
+                break;
+            case 2:
+                shapes.push_back(std::make_unique<Line>(x, y, coord(rnd), coord(rnd)));
+                break;
+            default:
+                shapes.push_back(std::make_unique<Square>(x, y, size(rnd)));
+            }
+        }
+        return shapes;
+    }
+
+    uint32_t color_of(size_t i)
+    {
+        return rgba(static_cast<uint8_t>(i * 37), static_cast<uint8_t>(i * 91), static_cast<uint8_t>(i * 13));
+    }
+} // namespace
+
+TEST_CASE("Framebuffer")
+{
+    Framebuffer frame{4, 3, white};
+
+    CHECK(count_pixels(frame, white) == 12);
+
+    frame.fill_span(1, 1, 2, black);
+    CHECK(frame.pixel(0, 1) == white);
+    CHECK(frame.pixel(1, 1) == black);
+    CHECK(frame.pixel(2, 1) == black);
+    CHECK(frame.pixel(3, 1) == white);
+
+    SECTION("PPM")
+    {
+        std::ostringstream out;
+        frame.write_ppm(out);
+        const std::string ppm = out.str();
+
+        CHECK(ppm.starts_with("P6\n4 3\n255\n"));
+        CHECK(ppm.size() == std::string{"P6\n4 3\n255\n"}.size() + 4 * 3 * 3);
+    }
+
+    CHECK_THROWS_AS((Framebuffer{0, 10}), std::invalid_argument);
+}
+
+TEST_CASE("Rasterizer - single shapes")
+{
+    Framebuffer frame{20, 20, black};
+    Rasterizer rasterizer{8};
+
+    SECTION("rectangle covers its bounding box")
+    {
+        Rectangle{2, 3, 4, 5}.draw(rasterizer);
+        rasterizer.render(frame);
+
+        CHECK(count_pixels(frame, white) == 5 * 6);
+        CHECK(frame.pixel(2, 3) == white);
+        CHECK(frame.pixel(6, 8) == white);
+        CHECK(frame.pixel(7, 8) == black);
+    }
+
+    SECTION("circle")
+    {
+        Circle{10, 10, 2}.draw(rasterizer);
+        rasterizer.render(frame);
+
+        CHECK(count_pixels(frame, white) == 13);
+        CHECK(frame.pixel(12, 10) == white);
+        CHECK(frame.pixel(11, 11) == white);
+        CHECK(frame.pixel(12, 11) == black);
+    }
+
+    SECTION("line crossing tiles")
+    {
+        Line{0, 0, 16, 8}.draw(rasterizer);
+        rasterizer.render(frame);
+
+        CHECK(count_pixels(frame, white) == 17);
+        CHECK(frame.pixel(0, 0) == white);
+        CHECK(frame.pixel(1, 1) == white);
+        CHECK(frame.pixel(8, 4) == white);
+        CHECK(frame.pixel(16, 8) == white);
+    }
+
+    SECTION("shapes outside of frame are clipped")
+    {
+        Circle{-10, -10, 5}.draw(rasterizer);
+        Line{-5, 30, 30, 30}.draw(rasterizer);
+        Rectangle{18, 18, 10, 10}.draw(rasterizer);
+        rasterizer.render(frame);
+
+        CHECK(count_pixels(frame, white) == 4);
+    }
+}
+
+TEST_CASE("Rasterizer - pixel hash does not depend on tiles & threads")
+{
+    const auto shapes = make_scene(200);
+
+    Framebuffer expected{200, 150, black};
+    for (size_t i = 0; i < shapes.size(); ++i)
+    {
+        ReferenceSink sink{expected, color_of(i)};
+        shapes[i]->draw(sink);
+    }
+
+    for (const int tile_size : {7, 16, 64, 1024})
+    {
+        Rasterizer rasterizer{tile_size};
+        for (size_t i = 0; i < shapes.size(); ++i)
+        {
+            rasterizer.set_color(color_of(i));
+            shapes[i]->draw(rasterizer);
+        }
+
+        for (const size_t threads : {1, 2, 4, 8})
+        {
+            Framebuffer frame{200, 150, black};
+            rasterizer.render(frame, threads);
+
+            INFO("tile size: " << tile_size << "; threads: " << threads);
+            CHECK(frame.hash() == expected.hash());
+        }
+    }
+}
+
+TEST_CASE("Rasterizer - pixel hash of fixed scene")
+{
+    Rasterizer rasterizer{16};
+    rasterizer.set_color(rgba(200, 30, 30));
+    Circle{40, 30, 25}.draw(rasterizer);
+    rasterizer.set_color(rgba(30, 200, 30, 128));
+    Rectangle{10, 10, 50, 20}.draw(rasterizer);
+    rasterizer.set_color(rgba(30, 30, 200));
+    Line{0, 59, 79, 0}.draw(rasterizer);
+    Line{5, 0, 12, 59}.draw(rasterizer);
+    Square{70, 50, 20}.draw(rasterizer);
+
+    Framebuffer frame{80, 60, white};
+    rasterizer.render(frame, 3);
+
+    CHECK(frame.hash() == 0x180f'e205'93f1'a7e0);
+}
@@ -0,0 +1,201 @@
+#ifndef RENDER_SINK_HPP
+#define RENDER_SINK_HPP
+
+#include "point.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <format>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Drawing
+{
+    // target of Shape::draw() - receives one call per drawn shape
+    class RenderSink
+    {
+    public:
+        virtual void circle(Point center, uint16_t radius) = 0;
+        virtual void rectangle(Point corner, uint16_t width, uint16_t height) = 0;
+        virtual void line(Point start, Point end) = 0;
+        virtual ~RenderSink() = default;
+    };
+
+    // Text backend - descriptions of shapes are formatted into a reusable buffer
+    // - flush() writes the whole frame to the stream with a single call - flushing the stream itself is left to the caller
+    // - remaining text is flushed by destructor
+    class TextRenderSink : public RenderSink
+    {
+    public:
+        explicit TextRenderSink(std::ostream& out = std::cout)
+            : out_{out}
+        {
+        }
+
+        TextRenderSink(const TextRenderSink&) = delete;
+        TextRenderSink& operator=(const TextRenderSink&) = delete;
+
+        ~TextRenderSink() override
+        {
+            flush();
+        }
+
+        void circle(Point center, uint16_t radius) override
+        {
+            std::format_to(std::back_inserter(buffer_), "Drawing Circle at Point{{{}, {}}} with radius {}\n", center.x, center.y, radius);
+        }
+
+        void rectangle(Point corner, uint16_t width, uint16_t height) override
+        {
+            std::format_to(std::back_inserter(buffer_), "Drawing Rectangle at Point{{{}, {}}} with dimensions (width: {}, height: {})\n",
+                corner.x, corner.y, width, height);
+        }
+
+        void line(Point start, Point end) override
+        {
+            std::format_to(std::back_inserter(buffer_), "Drawing Line from Point{{{}, {}}} to Point{{{}, {}}}\n", start.x, start.y, end.x, end.y);
+        }
+
+        // text formatted since last flush
+        std::string_view text() const noexcept
+        {
+            return buffer_;
+        }
+
+        // capacity of buffer is kept for the next frame
+        void flush()
+        {
+            if (buffer_.empty())
+                return;
+
+            out_.write(buffer_.data(), static_cast<std::streamsize>(buffer_.size()));
+            buffer_.clear();
+        }
+
+    private:
+        std::ostream& out_;
+        std::string buffer_;
+    };
+
+    // text sink of the calling thread writing to std::cout - used by draw() without arguments
+    // - its buffer is reused, so drawing a single shape does not allocate
+    inline TextRenderSink& cout_render_sink()
+    {
+        thread_local TextRenderSink sink{std::cout};
+        return sink;
+    }
+
+    // Binary backend - compact stream of render commands (opcode byte followed by raw fields)
+    // - commands can be replayed into another sink, e.g. by a renderer thread
+    class RenderCommandBuffer : public RenderSink
+    {
+    public:
+        enum class Opcode : uint8_t
+        {
+            circle,
+            rectangle,
+            line
+        };
+
+        void circle(Point center, uint16_t radius) override
+        {
+            append(Opcode::circle, center, radius);
+        }
+
+        void rectangle(Point corner, uint16_t width, uint16_t height) override
+        {
+            append(Opcode::rectangle, corner, width, height);
+        }
+
+        void line(Point start, Point end) override
+        {
+            append(Opcode::line, start, end);
+        }
+
+        size_t size() const noexcept
+        {
+            return count_;
+        }
+
+        size_t size_bytes() const noexcept
+        {
+            return bytes_.size();
+        }
+
+        const std::byte* data() const noexcept
+        {
+            return bytes_.data();
+        }
+
+        // capacity of buffer is kept for the next frame
+        void clear() noexcept
+        {
+            bytes_.clear();
+            count_ = 0;
+        }
+
+        // sends all commands to sink in recorded order
+        void replay(RenderSink& sink) const
+        {
+            for (size_t pos = 0; pos < bytes_.size();)
+            {
+                const auto opcode = read<Opcode>(pos);
+                switch (opcode)
+                {
+                case Opcode::circle:
+                {
+                    const auto center = read<Point>(pos);
+                    sink.circle(center, read<uint16_t>(pos));
+                    break;
+                }
+                case Opcode::rectangle:
+                {
+                    const auto corner = read<Point>(pos);
+                    const auto width = read<uint16_t>(pos);
+                    sink.rectangle(corner, width, read<uint16_t>(pos));
+                    break;
+                }
+                case Opcode::line:
+                {
+                    const auto start = read<Point>(pos);
+                    sink.line(start, read<Point>(pos));
+                    break;
+                }
+                }
+            }
+        }
+
+    private:
+        std::vector<std::byte> bytes_;
+        size_t count_{};
+
+        // fields are copied without padding - they are read back with memcpy
+        template <typename... Fields>
+        void append(Opcode opcode, const Fields&... fields)
+        {
+            size_t pos = bytes_.size();
+            bytes_.resize(pos + sizeof(opcode) + (sizeof(Fields) + ...));
+
+            std::memcpy(bytes_.data() + pos, &opcode, sizeof(opcode));
+            pos += sizeof(opcode);
+            ((std::memcpy(bytes_.data() + pos, &fields, sizeof(fields)), pos += sizeof(fields)), ...);
+
+            ++count_;
+        }
+
+        template <typename T>
+        T read(size_t& pos) const
+        {
+            T value;
+            std::memcpy(&value, bytes_.data() + pos, sizeof(T));
+            pos += sizeof(T);
+            return value;
+        }
+    };
+} // namespace Drawing
+
+#endif // RENDER_SINK_HPP
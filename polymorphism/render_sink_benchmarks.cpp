@@ -0,0 +1,119 @@
+#include "shape.hpp"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+    // draws frame repeatedly for at least 200ms and prints number of shapes drawn per second
+    template <typename DrawFrame>
+    void report_shapes_per_second(const std::string& name, size_t shapes_per_frame, DrawFrame draw_frame)
+    {
+        using namespace std::chrono;
+
+        size_t frames = 0;
+        const auto start = steady_clock::now();
+        auto elapsed = steady_clock::duration{};
+        do
+        {
+            draw_frame();
+            ++frames;
+            elapsed = steady_clock::now() - start;
+        } while (elapsed < 200ms);
+
+        const double seconds = duration<double>(elapsed).count();
+        std::cout << std::left << std::setw(48) << name << std::fixed << std::setprecision(2)
+                  << (static_cast<double>(shapes_per_frame) * frames / seconds / 1e6) << " M shapes/s\n";
+    }
+} // namespace
+
+TEST_CASE("RenderSink - shapes drawn per second", "[RenderSink]")
+{
+    using namespace Drawing;
+
+    constexpr int n = 100'000;
+
+    std::vector<std::unique_ptr<Shape>> shapes;
+    for (int i = 0; i < n; ++i)
+    {
+        if (i % 3 == 0)
+            shapes.push_back(std::make_unique<Circle>(i, -i, 10));
+        else if (i % 3 == 1)
+            shapes.push_back(std::make_unique<Rectangle>(i, -i, 10, 20));
+        else
+            shapes.push_back(std::make_unique<Line>(i, -i, i + 10, i + 10));
+    }
+
+    std::ofstream null_output{"/dev/null"}; // formatting & writing is measured - not the terminal
+
+    // draw() before render sinks - iostream call chain for every field
+    class IostreamSink : public RenderSink
+    {
+    public:
+        explicit IostreamSink(std::ostream& out)
+            : out_{out}
+        {
+        }
+
+        void circle(Point center, uint16_t radius) override
+        {
+            out_ << "Drawing Circle at " << center << " with radius " << radius << "\n";
+        }
+
+        void rectangle(Point corner, uint16_t width, uint16_t height) override
+        {
+            out_ << "Drawing Rectangle at " << corner << " with dimensions (width: " << width << ", height: " << height << ")\n";
+        }
+
+        void line(Point start, Point end) override
+        {
+            out_ << "Drawing Line from " << start << " to " << end << "\n";
+        }
+
+    private:
+        std::ostream& out_;
+    };
+
+    IostreamSink iostream_sink{null_output};
+    report_shapes_per_second("iostream per field", n, [&] {
+        for (const auto& shp : shapes)
+            shp->draw(iostream_sink);
+        null_output.flush();
+    });
+
+    TextRenderSink text_sink{null_output};
+    report_shapes_per_second("TextRenderSink - format_to + one write", n, [&] {
+        for (const auto& shp : shapes)
+            shp->draw(text_sink);
+        text_sink.flush();
+    });
+
+    RenderCommandBuffer commands;
+    report_shapes_per_second("RenderCommandBuffer", n, [&] {
+        commands.clear();
+        for (const auto& shp : shapes)
+            shp->draw(commands);
+    });
+
+    BENCHMARK("TextRenderSink - frame of 100K shapes")
+    {
+        for (const auto& shp : shapes)
+            shp->draw(text_sink);
+        text_sink.flush();
+    };
+
+    BENCHMARK("RenderCommandBuffer - frame of 100K shapes")
+    {
+        commands.clear();
+        for (const auto& shp : shapes)
+            shp->draw(commands);
+        return commands.size_bytes();
+    };
+}
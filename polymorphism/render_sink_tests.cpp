@@ -0,0 +1,129 @@
+#include "shape.hpp"
+#include "shape_store.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <vector>
+
+namespace
+{
+    // same text as written by iostreams before draw() used render sinks
+    std::string legacy_text()
+    {
+        using Drawing::Point;
+
+        std::ostringstream out;
+        out << "Drawing Circle at " << Point{17, 87} << " with radius " << 60 << "\n";
+        out << "Drawing Rectangle at " << Point{10, -20} << " with dimensions (width: " << 60 << ", height: " << 55 << ")\n";
+        out << "Drawing Line from " << Point{10, 20} << " to " << Point{60, 70} << "\n";
+        return out.str();
+    }
+
+    // string buffer counting flushes of the stream using it
+    class SyncCountingBuffer : public std::stringbuf
+    {
+    public:
+        int syncs{};
+
+    protected:
+        int sync() override
+        {
+            ++syncs;
+            return std::stringbuf::sync();
+        }
+    };
+
+    // redirects std::cout to buffer for its lifetime
+    class CoutRedirect
+    {
+    public:
+        explicit CoutRedirect(std::streambuf* buffer)
+            : previous_{std::cout.rdbuf(buffer)}
+        {
+        }
+
+        CoutRedirect(const CoutRedirect&) = delete;
+        CoutRedirect& operator=(const CoutRedirect&) = delete;
+
+        ~CoutRedirect()
+        {
+            std::cout.rdbuf(previous_);
+        }
+
+    private:
+        std::streambuf* previous_;
+    };
+} // namespace
+
+TEST_CASE("RenderSink")
+{
+    using namespace Drawing;
+
+    std::vector<std::unique_ptr<Shape>> shapes;
+    shapes.push_back(std::make_unique<Circle>(17, 87, 60));
+    shapes.push_back(std::make_unique<Rectangle>(10, -20, 60, 55));
+    shapes.push_back(std::make_unique<Line>(10, 20, 60, 70));
+
+    SECTION("text backend preserves output of draw()")
+    {
+        std::ostringstream out;
+        TextRenderSink sink{out};
+        for (const auto& shp : shapes)
+            shp->draw(sink);
+
+        CHECK(sink.text() == legacy_text());
+        CHECK(out.str().empty()); // nothing is written before flush
+
+        sink.flush();
+        CHECK(out.str() == legacy_text());
+        CHECK(sink.text().empty());
+    }
+
+    SECTION("draw() writes to std::cout without flushing it")
+    {
+        SyncCountingBuffer out;
+        {
+            CoutRedirect redirect{&out};
+            for (const auto& shp : shapes)
+                shp->draw();
+        }
+
+        CHECK(out.str() == legacy_text());
+        CHECK(out.syncs == 0);
+    }
+
+    SECTION("command buffer")
+    {
+        RenderCommandBuffer commands;
+        for (const auto& shp : shapes)
+            shp->draw(commands);
+
+        CHECK(commands.size() == 3);
+        CHECK(commands.size_bytes() == (1 + 8 + 2) + (1 + 8 + 4) + (1 + 16));
+
+        std::ostringstream out;
+        {
+            TextRenderSink sink{out};
+            commands.replay(sink);
+        } // flushed by destructor
+        CHECK(out.str() == legacy_text());
+
+        commands.clear();
+        CHECK(commands.size_bytes() == 0);
+    }
+
+    SECTION("ShapeStore")
+    {
+        ShapeStore store;
+        store.add_circle(17, 87, 60);
+        store.add_rectangle(10, -20, 60, 55);
+        store.add_line(10, 20, 60, 70);
+
+        std::ostringstream out;
+        TextRenderSink sink{out};
+        store.draw_all(sink);
+        CHECK(sink.text() == legacy_text());
+    }
+}
@@ -0,0 +1,232 @@
+#ifndef SCENE_FILE_HPP
+#define SCENE_FILE_HPP
+
+#include "../vector/mmap_vector.hpp"
+#include "render_sink.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <vector>
+
+namespace Drawing
+{
+    // Binary scene file - version 1
+    // - header (64 bytes) followed by one packed array of records per kind of shape
+    // - all fields are little-endian with fixed size; arrays start at offsets aligned to 64 bytes
+    // - records are read in place from a mapped file, so the format matches memory layout of little-endian hosts
+    static_assert(std::endian::native == std::endian::little, "scene files are mapped without conversion of byte order");
+
+    struct CircleRecord
+    {
+        Point center;
+        uint16_t radius;
+        uint16_t reserved; // zero
+    };
+
+    struct RectangleRecord
+    {
+        Point corner;
+        uint16_t width, height;
+    };
+
+    struct LineRecord
+    {
+        Point start, end;
+    };
+
+    struct SceneHeader
+    {
+        struct Section
+        {
+            uint64_t count;  // number of records
+            uint64_t offset; // from start of file
+        };
+
+        static constexpr std::array<char, 8> signature{'D', 'R', 'W', 'S', 'C', 'E', 'N', 'E'};
+        static constexpr uint32_t current_version = 1;
+
+        std::array<char, 8> magic;
+        uint32_t version;
+        uint32_t header_size;
+        Section circles, rectangles, lines;
+    };
+
+    static_assert(sizeof(Point) == 8 && sizeof(CircleRecord) == 12 && sizeof(RectangleRecord) == 12 && sizeof(LineRecord) == 16);
+    static_assert(sizeof(SceneHeader) == 64);
+
+    // Collects shapes drawn into it & writes them to a scene file
+    // - shapes are stored by what they draw - e.g. Square is saved as a rectangle
+    class SceneWriter : public RenderSink
+    {
+    public:
+        static constexpr size_t section_alignment = 64;
+
+        void circle(Point center, uint16_t radius) override
+        {
+            circles_.push_back(CircleRecord{center, radius, 0});
+        }
+
+        void rectangle(Point corner, uint16_t width, uint16_t height) override
+        {
+            rectangles_.push_back(RectangleRecord{corner, width, height});
+        }
+
+        void line(Point start, Point end) override
+        {
+            lines_.push_back(LineRecord{start, end});
+        }
+
+        size_t size() const noexcept
+        {
+            return circles_.size() + rectangles_.size() + lines_.size();
+        }
+
+        void reserve(size_t circles, size_t rectangles, size_t lines)
+        {
+            circles_.reserve(circles);
+            rectangles_.reserve(rectangles);
+            lines_.reserve(lines);
+        }
+
+        void clear() noexcept
+        {
+            circles_.clear();
+            rectangles_.clear();
+            lines_.clear();
+        }
+
+        void write(const std::filesystem::path& path) const
+        {
+            SceneHeader header{SceneHeader::signature, SceneHeader::current_version, sizeof(SceneHeader), {}, {}, {}};
+            uint64_t offset = sizeof(SceneHeader);
+            header.circles = section(circles_, offset);
+            header.rectangles = section(rectangles_, offset);
+            header.lines = section(lines_, offset);
+
+            std::ofstream out{path, std::ios::binary | std::ios::trunc};
+            if (!out)
+                throw std::system_error{errno, std::generic_category(), "cannot open " + path.string()};
+
+            out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            write_section(out, circles_, header.circles);
+            write_section(out, rectangles_, header.rectangles);
+            write_section(out, lines_, header.lines);
+
+            out.flush();
+            if (!out)
+                throw std::system_error{errno, std::generic_category(), "cannot write " + path.string()};
+        }
+
+    private:
+        std::vector<CircleRecord> circles_;
+        std::vector<RectangleRecord> rectangles_;
+        std::vector<LineRecord> lines_;
+
+        // places section at the next aligned offset
+        template <typename Record>
+        static SceneHeader::Section section(const std::vector<Record>& records, uint64_t& offset) noexcept
+        {
+            offset = (offset + section_alignment - 1) / section_alignment * section_alignment;
+            const SceneHeader::Section result{records.size(), offset};
+            offset += records.size() * sizeof(Record);
+            return result;
+        }
+
+        template <typename Record>
+        static void write_section(std::ofstream& out, const std::vector<Record>& records, const SceneHeader::Section& section)
+        {
+            static constexpr std::array<char, section_alignment> padding{};
+            out.write(padding.data(), static_cast<std::streamsize>(section.offset - static_cast<uint64_t>(out.tellp())));
+            out.write(reinterpret_cast<const char*>(records.data()), static_cast<std::streamsize>(records.size() * sizeof(Record)));
+        }
+    };
+
+    // Scene file mapped into memory (read-only) - records are exposed as views without copying
+    // - header & bounds of sections are validated when file is opened
+    // - pages of file are loaded on first access
+    class SceneFile
+    {
+    public:
+        explicit SceneFile(const std::filesystem::path& path)
+            : bytes_{path}
+        {
+            if (bytes_.size() < sizeof(SceneHeader))
+                throw std::runtime_error{path.string() + " is not a scene file - it is too short"};
+
+            const SceneHeader& header = this->header();
+            if (header.magic != SceneHeader::signature)
+                throw std::runtime_error{path.string() + " is not a scene file"};
+            if (header.version != SceneHeader::current_version || header.header_size != sizeof(SceneHeader))
+                throw std::runtime_error{"unsupported version of scene file " + path.string()};
+
+            circles_ = section<CircleRecord>(header.circles, path);
+            rectangles_ = section<RectangleRecord>(header.rectangles, path);
+            lines_ = section<LineRecord>(header.lines, path);
+        }
+
+        const SceneHeader& header() const noexcept
+        {
+            return *reinterpret_cast<const SceneHeader*>(bytes_.data());
+        }
+
+        size_t size() const noexcept
+        {
+            return circles_.size() + rectangles_.size() + lines_.size();
+        }
+
+        std::span<const CircleRecord> circles() const noexcept
+        {
+            return circles_;
+        }
+
+        std::span<const RectangleRecord> rectangles() const noexcept
+        {
+            return rectangles_;
+        }
+
+        std::span<const LineRecord> lines() const noexcept
+        {
+            return lines_;
+        }
+
+        // sends all shapes to sink - kind by kind
+        void draw_all(RenderSink& sink) const
+        {
+            for (const auto& [center, radius, reserved] : circles_)
+                sink.circle(center, radius);
+            for (const auto& [corner, width, height] : rectangles_)
+                sink.rectangle(corner, width, height);
+            for (const auto& [start, end] : lines_)
+                sink.line(start, end);
+        }
+
+    private:
+        ModernCpp::MmapVector<const std::byte> bytes_;
+        std::span<const CircleRecord> circles_;
+        std::span<const RectangleRecord> rectangles_;
+        std::span<const LineRecord> lines_;
+
+        template <typename Record>
+        std::span<const Record> section(const SceneHeader::Section& section, const std::filesystem::path& path) const
+        {
+            const uint64_t file_size = bytes_.size();
+            if (section.offset % alignof(Record) != 0 || section.offset > file_size
+                || section.count > (file_size - section.offset) / sizeof(Record))
+                throw std::runtime_error{"section of scene file " + path.string() + " is out of bounds"};
+
+            return {reinterpret_cast<const Record*>(bytes_.data() + section.offset), static_cast<size_t>(section.count)};
+        }
+    };
+} // namespace Drawing
+
+#endif // SCENE_FILE_HPP
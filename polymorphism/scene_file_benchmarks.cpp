@@ -0,0 +1,150 @@
+#include "scene_file.hpp"
+#include "shape.hpp"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+    // runs action once & prints its time and number of shapes per second
+    template <typename Action>
+    void report_load_time(const std::string& name, size_t shapes, Action action)
+    {
+        using namespace std::chrono;
+
+        const auto start = steady_clock::now();
+        action();
+        const double seconds = duration<double>(steady_clock::now() - start).count();
+
+        std::cout << std::left << std::setw(56) << name << std::fixed << std::setprecision(3)
+                  << std::setw(10) << seconds * 1e3 << " ms; " << std::setprecision(1)
+                  << std::setw(8) << (static_cast<double>(shapes) / seconds / 1e6) << " M shapes/s\n";
+    }
+
+    // sum of coordinates - every record is read
+    class ChecksumSink : public Drawing::RenderSink
+    {
+    public:
+        void circle(Drawing::Point center, uint16_t radius) override
+        {
+            sum += center.x + center.y + radius;
+        }
+
+        void rectangle(Drawing::Point corner, uint16_t width, uint16_t height) override
+        {
+            sum += corner.x + corner.y + width + height;
+        }
+
+        void line(Drawing::Point start, Drawing::Point end) override
+        {
+            sum += start.x + start.y + end.x + end.y;
+        }
+
+        int64_t sum{};
+    };
+
+    // text scene as written by TextRenderSink - one allocation per shape
+    std::vector<std::unique_ptr<Drawing::Shape>> parse_text_scene(const std::filesystem::path& path)
+    {
+        using namespace Drawing;
+
+        std::vector<std::unique_ptr<Shape>> shapes;
+        std::ifstream in{path};
+        for (std::string line; std::getline(in, line);)
+        {
+            int x, y, end_x, end_y, width, height, radius;
+            if (std::sscanf(line.c_str(), "Drawing Circle at Point{%d, %d} with radius %d", &x, &y, &radius) == 3)
+                shapes.push_back(std::make_unique<Circle>(x, y, static_cast<uint16_t>(radius)));
+            else if (std::sscanf(line.c_str(), "Drawing Rectangle at Point{%d, %d} with dimensions (width: %d, height: %d)", &x, &y, &width, &height) == 4)
+                shapes.push_back(std::make_unique<Rectangle>(x, y, static_cast<uint16_t>(width), static_cast<uint16_t>(height)));
+            else if (std::sscanf(line.c_str(), "Drawing Line from Point{%d, %d} to Point{%d, %d}", &x, &y, &end_x, &end_y) == 4)
+                shapes.push_back(std::make_unique<Line>(x, y, end_x, end_y));
+        }
+        return shapes;
+    }
+
+    template <typename Action>
+    void for_each_shape(size_t n, Action action)
+    {
+        using namespace Drawing;
+
+        for (int i = 0; i < static_cast<int>(n); ++i)
+        {
+            if (i % 3 == 0)
+                action(Circle{i, -i, static_cast<uint16_t>(i)});
+            else if (i % 3 == 1)
+                action(Rectangle{i, -i, 10, static_cast<uint16_t>(i)});
+            else
+                action(Line{i, -i, i + 10, i - 10});
+        }
+    }
+} // namespace
+
+TEST_CASE("SceneFile - load 10M shapes", "[SceneFile]")
+{
+    using namespace Drawing;
+
+    constexpr size_t n = 10'000'000;
+    constexpr size_t text_n = 1'000'000; // text baseline is measured on a smaller scene
+
+    const auto binary_path = std::filesystem::temp_directory_path() / "scene_file_benchmark.bin";
+    const auto text_path = std::filesystem::temp_directory_path() / "scene_file_benchmark.txt";
+
+    {
+        SceneWriter writer;
+        writer.reserve(n / 3 + 1, n / 3 + 1, n / 3 + 1);
+        for_each_shape(n, [&](const Shape& shape) { shape.draw(writer); });
+        report_load_time("write binary scene", n, [&] { writer.write(binary_path); });
+    }
+
+    {
+        std::ofstream text_file{text_path};
+        TextRenderSink writer{text_file};
+        for_each_shape(text_n, [&](const Shape& shape) { shape.draw(writer); });
+    }
+
+    std::cout << "binary: " << std::filesystem::file_size(binary_path) / (1024 * 1024) << " MiB for " << n << " shapes; text: "
+              << std::filesystem::file_size(text_path) / (1024 * 1024) << " MiB for " << text_n << " shapes (page cache is warm)\n";
+
+    report_load_time("text - parse into vector<unique_ptr<Shape>>", text_n, [&] {
+        const auto shapes = parse_text_scene(text_path);
+        REQUIRE(shapes.size() == text_n);
+    });
+
+    report_load_time("binary - open (map & validate)", n, [&] {
+        const SceneFile scene{binary_path};
+        REQUIRE(scene.size() == n);
+    });
+
+    report_load_time("binary - open & read every record", n, [&] {
+        const SceneFile scene{binary_path};
+        ChecksumSink checksum;
+        scene.draw_all(checksum);
+        REQUIRE(checksum.sum != 0);
+    });
+
+    report_load_time("binary - open & build vector<unique_ptr<Shape>>", n, [&] {
+        const SceneFile scene{binary_path};
+        std::vector<std::unique_ptr<Shape>> shapes;
+        shapes.reserve(scene.size());
+        for (const auto& [center, radius, reserved] : scene.circles())
+            shapes.push_back(std::make_unique<Circle>(center.x, center.y, radius));
+        for (const auto& [corner, width, height] : scene.rectangles())
+            shapes.push_back(std::make_unique<Rectangle>(corner.x, corner.y, width, height));
+        for (const auto& [start, end] : scene.lines())
+            shapes.push_back(std::make_unique<Line>(start.x, start.y, end.x, end.y));
+        REQUIRE(shapes.size() == n);
+    });
+
+    std::filesystem::remove(binary_path);
+    std::filesystem::remove(text_path);
+}
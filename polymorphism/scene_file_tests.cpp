@@ -0,0 +1,178 @@
+#include "scene_file.hpp"
+#include "shape.hpp"
+
+#include <atomic>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <vector>
+
+using namespace Drawing;
+
+namespace
+{
+    // unique file in temp directory - removed at the end of test
+    class TempFile
+    {
+    public:
+        TempFile()
+            : path_{std::filesystem::temp_directory_path() / ("scene_file_test_" + std::to_string(counter_++) + ".bin")}
+        {
+            std::filesystem::remove(path_);
+        }
+
+        TempFile(const TempFile&) = delete;
+        TempFile& operator=(const TempFile&) = delete;
+
+        ~TempFile()
+        {
+            std::filesystem::remove(path_);
+        }
+
+        const std::filesystem::path& path() const noexcept
+        {
+            return path_;
+        }
+
+    private:
+        inline static std::atomic<int> counter_{};
+        std::filesystem::path path_;
+    };
+
+    // overwrites bytes of file at offset
+    void patch(const std::filesystem::path& path, std::streamoff offset, const std::string& bytes)
+    {
+        std::fstream file{path, std::ios::binary | std::ios::in | std::ios::out};
+        file.seekp(offset);
+        file.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+    }
+} // namespace
+
+TEST_CASE("SceneFile - round trip")
+{
+    TempFile file;
+
+    std::vector<std::unique_ptr<Shape>> shapes;
+    shapes.push_back(std::make_unique<Circle>(10, -20, 5));
+    shapes.push_back(std::make_unique<Line>(1, 2, 3, 4));
+    shapes.push_back(std::make_unique<Rectangle>(-7, 8, 9, 10));
+    shapes.push_back(std::make_unique<Circle>(0, 0, 65535));
+    shapes.push_back(std::make_unique<Square>(100, 200, 30));
+
+    SceneWriter writer;
+    for (const auto& shape : shapes)
+        shape->draw(writer);
+    REQUIRE(writer.size() == 5);
+    writer.write(file.path());
+
+    const SceneFile scene{file.path()};
+
+    CHECK(scene.size() == 5);
+    CHECK(scene.header().version == SceneHeader::current_version);
+    CHECK(scene.header().circles.offset % SceneWriter::section_alignment == 0);
+    CHECK(scene.header().rectangles.offset % SceneWriter::section_alignment == 0);
+    CHECK(scene.header().lines.offset % SceneWriter::section_alignment == 0);
+
+    REQUIRE(scene.circles().size() == 2);
+    CHECK(scene.circles()[0].center.x == 10);
+    CHECK(scene.circles()[0].center.y == -20);
+    CHECK(scene.circles()[0].radius == 5);
+    CHECK(scene.circles()[1].radius == 65535);
+
+    REQUIRE(scene.rectangles().size() == 2); // square is stored as rectangle
+    CHECK(scene.rectangles()[0].corner.x == -7);
+    CHECK(scene.rectangles()[0].width == 9);
+    CHECK(scene.rectangles()[0].height == 10);
+    CHECK(scene.rectangles()[1].corner.y == 200);
+    CHECK(scene.rectangles()[1].width == 30);
+
+    REQUIRE(scene.lines().size() == 1);
+    CHECK(scene.lines()[0].start.x == 1);
+    CHECK(scene.lines()[0].end.y == 4);
+
+    SECTION("draw_all sends shapes kind by kind")
+    {
+        std::ostringstream out;
+        {
+            TextRenderSink sink{out};
+            scene.draw_all(sink);
+        }
+
+        CHECK(out.str()
+            == "Drawing Circle at Point{10, -20} with radius 5\n"
+               "Drawing Circle at Point{0, 0} with radius 65535\n"
+               "Drawing Rectangle at Point{-7, 8} with dimensions (width: 9, height: 10)\n"
+               "Drawing Rectangle at Point{100, 200} with dimensions (width: 30, height: 30)\n"
+               "Drawing Line from Point{1, 2} to Point{3, 4}\n");
+    }
+
+    SECTION("scene written again is identical")
+    {
+        TempFile copy;
+
+        SceneWriter copy_writer;
+        scene.draw_all(copy_writer);
+        copy_writer.write(copy.path());
+
+        CHECK(std::filesystem::file_size(copy.path()) == std::filesystem::file_size(file.path()));
+
+        const SceneFile copied_scene{copy.path()};
+        CHECK(copied_scene.size() == scene.size());
+        CHECK(std::memcmp(copied_scene.lines().data(), scene.lines().data(), scene.lines().size_bytes()) == 0);
+    }
+}
+
+TEST_CASE("SceneFile - empty scene")
+{
+    TempFile file;
+    SceneWriter{}.write(file.path());
+
+    const SceneFile scene{file.path()};
+    CHECK(scene.size() == 0);
+    CHECK(scene.circles().empty());
+    CHECK(scene.rectangles().empty());
+    CHECK(scene.lines().empty());
+}
+
+TEST_CASE("SceneFile - invalid files are rejected")
+{
+    TempFile file;
+
+    SceneWriter writer;
+    writer.circle({1, 2}, 3);
+    writer.line({1, 2}, {3, 4});
+    writer.write(file.path());
+
+    SECTION("missing file")
+    {
+        CHECK_THROWS_AS(SceneFile{file.path().string() + ".missing"}, std::system_error);
+    }
+
+    SECTION("wrong signature")
+    {
+        patch(file.path(), 0, "NOTSCENE");
+        CHECK_THROWS_AS(SceneFile{file.path()}, std::runtime_error);
+    }
+
+    SECTION("unsupported version")
+    {
+        patch(file.path(), 8, std::string{"\x02\x00\x00\x00", 4});
+        CHECK_THROWS_AS(SceneFile{file.path()}, std::runtime_error);
+    }
+
+    SECTION("truncated file")
+    {
+        std::filesystem::resize_file(file.path(), std::filesystem::file_size(file.path()) - 1);
+        CHECK_THROWS_AS(SceneFile{file.path()}, std::runtime_error);
+
+        std::filesystem::resize_file(file.path(), 10);
+        CHECK_THROWS_AS(SceneFile{file.path()}, std::runtime_error);
+    }
+}
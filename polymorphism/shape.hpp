@@ -2,6 +2,8 @@
 #define SHAPE_HPP
 
 #include "point.hpp"
+#include "render_sink.hpp"
+#include <algorithm>
 #include <cassert>
 
 namespace Drawing
@@ -11,11 +13,28 @@ namespace Drawing
     {
     public:
         virtual void move(int dx, int dy) = 0;
-        virtual void draw() const = 0;
+        virtual Box bounding_box() const = 0;
+
+        // writes description of shape to std::cout (stream is not flushed)
+        void draw() const
+        {
+            TextRenderSink& sink = cout_render_sink();
+            do_draw(sink);
+            sink.flush();
+        }
+
+        void draw(RenderSink& sink) const
+        {
+            do_draw(sink);
+        }
+
         virtual ~Shape() = default;
+
+    private:
+        virtual void do_draw(RenderSink& sink) const = 0; // non-virtual interface - both draw() call it
     };
 
-    // abstract class - draw() is pure virtual
+    // abstract class - do_draw() is pure virtual
     class ShapeBase : public Shape
     {
     private:
@@ -69,9 +88,16 @@ namespace Drawing
             radius_ = r;
         }
 
-        void draw() const override
+        Box bounding_box() const override
         {
-            std::cout << "Drawing Circle at " << coord() << " with radius " << radius_ << "\n";
+            const Point center = coord();
+            return Box{{center.x - radius_, center.y - radius_}, {center.x + radius_, center.y + radius_}};
+        }
+
+    private:
+        void do_draw(RenderSink& sink) const override
+        {
+            sink.circle(coord(), radius_);
         }
     };
 
@@ -105,12 +131,18 @@ namespace Drawing
             h_ = h;
         }
 
-        void draw() const override
+        Box bounding_box() const override
         {
-            std::cout << "Drawing Rectangle at " << coord() << " with dimensions (width: " << w_ << ", height: " << h_ << ")\n";
+            const Point corner = coord();
+            return Box{corner, {corner.x + w_, corner.y + h_}};
         }
 
     private:
+        void do_draw(RenderSink& sink) const override
+        {
+            sink.rectangle(coord(), w_, h_);
+        }
+
         uint16_t w_;
         uint16_t h_;
     };
@@ -126,16 +158,24 @@ namespace Drawing
         {
         }
 
-        void draw() const override
-        {
-            std::cout << "Drawing Line from " << coord() << " to " << end_coord_ << "\n";
-        }
-
         void move(int dx, int dy) override
         {
             ShapeBase::move(dx, dy); // call move from base class
             end_coord_.translate(dx, dy);
         }
+
+        Box bounding_box() const override
+        {
+            const Point start = coord();
+            return Box{{std::min(start.x, end_coord_.x), std::min(start.y, end_coord_.y)},
+                {std::max(start.x, end_coord_.x), std::max(start.y, end_coord_.y)}};
+        }
+
+    private:
+        void do_draw(RenderSink& sink) const override
+        {
+            sink.line(coord(), end_coord_);
+        }
     };
 
     class Square : public Shape
@@ -165,9 +205,15 @@ namespace Drawing
             rect_.move(dx, dy);
         }
 
-        void draw() const override
+        Box bounding_box() const override
+        {
+            return rect_.bounding_box();
+        }
+
+    private:
+        void do_draw(RenderSink& sink) const override
         {
-            rect_.draw();
+            rect_.draw(sink);
         }
     };
 } // namespace Drawing
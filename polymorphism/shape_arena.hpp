@@ -0,0 +1,173 @@
+#ifndef SHAPE_ARENA_HPP
+#define SHAPE_ARENA_HPP
+
+#include "shape.hpp"
+
+#include <concepts>
+#include <cstddef>
+#include <memory>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace Drawing
+{
+    // Owning pointer to a shape created by ShapeArena
+    // - destructor runs destructor of the shape (virtual for ArenaPtr<Shape>) - memory is released by the arena
+    // - the arena must outlive all its pointers
+    template <typename T>
+    class ArenaPtr
+    {
+    public:
+        ArenaPtr() noexcept = default;
+
+        explicit ArenaPtr(T* ptr) noexcept
+            : ptr_{ptr}
+        {
+        }
+
+        ArenaPtr(const ArenaPtr&) = delete;
+        ArenaPtr& operator=(const ArenaPtr&) = delete;
+
+        // move constructor - ArenaPtr<Circle> -> ArenaPtr<Shape>
+        template <typename U>
+            requires std::convertible_to<U*, T*>
+        ArenaPtr(ArenaPtr<U>&& source) noexcept
+            : ptr_{source.release()}
+        {
+        }
+
+        // move assignment
+        ArenaPtr& operator=(ArenaPtr&& source) noexcept
+        {
+            if (this != &source) // avoiding self assignment
+            {
+                ArenaPtr temp(std::move(source));
+                swap(temp);
+            }
+
+            return *this;
+        }
+
+        ~ArenaPtr()
+        {
+            if (ptr_)
+                std::destroy_at(ptr_);
+        }
+
+        void swap(ArenaPtr& that) noexcept
+        {
+            std::swap(ptr_, that.ptr_);
+        }
+
+        T* get() const noexcept
+        {
+            return ptr_;
+        }
+
+        T* release() noexcept
+        {
+            return std::exchange(ptr_, nullptr);
+        }
+
+        T& operator*() const noexcept
+        {
+            return *ptr_;
+        }
+
+        T* operator->() const noexcept
+        {
+            return ptr_;
+        }
+
+        explicit operator bool() const noexcept
+        {
+            return ptr_ != nullptr;
+        }
+
+    private:
+        T* ptr_{};
+    };
+
+    namespace Detail
+    {
+        // storage for shapes of type T - slabs of Capacity slots filled in order
+        template <typename T, size_t Capacity>
+        class ShapeSlabs
+        {
+            struct Slot
+            {
+                alignas(T) std::byte bytes[sizeof(T)];
+            };
+
+            std::vector<std::unique_ptr<Slot[]>> slabs_;
+            size_t size_{};
+
+        public:
+            template <typename... TArgs>
+            T* create(TArgs&&... args)
+            {
+                if (size_ == slabs_.size() * Capacity)
+                    slabs_.push_back(std::make_unique_for_overwrite<Slot[]>(Capacity));
+
+                Slot& slot = slabs_.back()[size_ % Capacity];
+                T* shape = std::construct_at(reinterpret_cast<T*>(slot.bytes), std::forward<TArgs>(args)...);
+                ++size_;
+                return shape;
+            }
+
+            size_t size() const noexcept
+            {
+                return size_;
+            }
+
+            size_t slab_count() const noexcept
+            {
+                return slabs_.size();
+            }
+        };
+    } // namespace Detail
+
+    // Arena for shapes of a scene - Circle, Rectangle, Line & Square objects are placement-constructed
+    // into contiguous slabs (one list of slabs per type)
+    // - creating a shape is a bump of an index - no call to malloc for most shapes
+    // - shapes of one type lie next to each other, so iterating over a scene touches few cache lines
+    // - memory of the whole scene is released at once, with one deallocation per slab
+    //   (slots of destroyed shapes are not reused before that)
+    class ShapeArena
+    {
+    public:
+        static constexpr size_t slab_capacity = 4096; // shapes per slab
+
+        ShapeArena() = default;
+
+        ShapeArena(const ShapeArena&) = delete;
+        ShapeArena& operator=(const ShapeArena&) = delete;
+
+        template <typename T, typename... TArgs>
+            requires(std::same_as<T, Circle> || std::same_as<T, Rectangle> || std::same_as<T, Line> || std::same_as<T, Square>)
+        ArenaPtr<T> create(TArgs&&... args)
+        {
+            return ArenaPtr<T>{std::get<Slabs<T>>(slabs_).create(std::forward<TArgs>(args)...)};
+        }
+
+        // number of created shapes
+        size_t size() const noexcept
+        {
+            return std::apply([](const auto&... slabs) { return (slabs.size() + ...); }, slabs_);
+        }
+
+        size_t slab_count() const noexcept
+        {
+            return std::apply([](const auto&... slabs) { return (slabs.slab_count() + ...); }, slabs_);
+        }
+
+    private:
+        template <typename T>
+        using Slabs = Detail::ShapeSlabs<T, slab_capacity>;
+
+        std::tuple<Slabs<Circle>, Slabs<Rectangle>, Slabs<Line>, Slabs<Square>> slabs_;
+    };
+} // namespace Drawing
+
+#endif // SHAPE_ARENA_HPP
@@ -0,0 +1,108 @@
+#include "shape_arena.hpp"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace
+{
+    constexpr int n = 1'000'000;
+
+    struct HeapScene
+    {
+        std::vector<std::unique_ptr<Drawing::Shape>> shapes;
+
+        template <typename T, typename... TArgs>
+        void add(TArgs... args)
+        {
+            shapes.push_back(std::make_unique<T>(args...));
+        }
+    };
+
+    struct ArenaScene
+    {
+        Drawing::ShapeArena arena; // declared first - outlives pointers
+        std::vector<Drawing::ArenaPtr<Drawing::Shape>> shapes;
+
+        template <typename T, typename... TArgs>
+        void add(TArgs... args)
+        {
+            shapes.push_back(arena.create<T>(args...));
+        }
+    };
+
+    template <typename Scene>
+    void build(Scene& scene)
+    {
+        using namespace Drawing;
+
+        scene.shapes.reserve(n);
+        for (int i = 0; i < n; ++i)
+        {
+            switch (i % 4)
+            {
+            case 0:
+                scene.template add<Circle>(i, -i, uint16_t{10});
+                break;
+            case 1:
+                scene.template add<Rectangle>(i, -i, uint16_t{10}, uint16_t{20});
+                break;
+            case 2:
+                scene.template add<Line>(i, -i, i + 10, i + 10);
+                break;
+            default:
+                scene.template add<Square>(i, -i, uint16_t{10});
+            }
+        }
+    }
+
+    // prints best time of each phase of scene lifetime: build, move & draw of all shapes, teardown
+    template <typename Scene>
+    void report_scene_lifetime(const std::string& name)
+    {
+        using namespace std::chrono;
+
+        constexpr int repetitions = 5;
+        double build_ms = 1e9, draw_ms = 1e9, teardown_ms = 1e9;
+
+        Drawing::RenderCommandBuffer commands;
+        for (int r = 0; r < repetitions; ++r)
+        {
+            std::optional<Scene> scene{std::in_place};
+
+            auto start = steady_clock::now();
+            build(*scene);
+            build_ms = std::min(build_ms, duration<double, std::milli>(steady_clock::now() - start).count());
+
+            commands.clear();
+            start = steady_clock::now();
+            for (const auto& shape : scene->shapes)
+            {
+                shape->move(1, 1);
+                shape->draw(commands);
+            }
+            draw_ms = std::min(draw_ms, duration<double, std::milli>(steady_clock::now() - start).count());
+
+            start = steady_clock::now();
+            scene.reset();
+            teardown_ms = std::min(teardown_ms, duration<double, std::milli>(steady_clock::now() - start).count());
+        }
+
+        std::cout << std::left << std::setw(40) << name << std::fixed << std::setprecision(2)
+                  << "build: " << std::setw(8) << build_ms << " ms; "
+                  << "move+draw: " << std::setw(8) << draw_ms << " ms; "
+                  << "teardown: " << std::setw(8) << teardown_ms << " ms\n";
+    }
+} // namespace
+
+TEST_CASE("ShapeArena - scene of 1M shapes", "[ShapeArena]")
+{
+    report_scene_lifetime<HeapScene>("vector<unique_ptr<Shape>>");
+    report_scene_lifetime<ArenaScene>("ShapeArena + vector<ArenaPtr<Shape>>");
+}
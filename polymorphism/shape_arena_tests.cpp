@@ -0,0 +1,87 @@
+#include "shape_arena.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+using namespace Drawing;
+
+TEST_CASE("ShapeArena - shapes keep Shape interface")
+{
+    ShapeArena arena;
+
+    std::vector<ArenaPtr<Shape>> shapes;
+    shapes.push_back(arena.create<Circle>(10, 20, 5));
+    shapes.push_back(arena.create<Rectangle>(1, 2, 3, 4));
+    shapes.push_back(arena.create<Line>(0, 0, 7, 8));
+    shapes.push_back(arena.create<Square>(5, 6, 7));
+
+    REQUIRE(arena.size() == 4);
+
+    for (const auto& shape : shapes)
+        shape->move(1, 1);
+
+    std::ostringstream out;
+    {
+        TextRenderSink sink{out};
+        for (const auto& shape : shapes)
+            shape->draw(sink);
+    }
+
+    CHECK(out.str()
+        == "Drawing Circle at Point{11, 21} with radius 5\n"
+           "Drawing Rectangle at Point{2, 3} with dimensions (width: 3, height: 4)\n"
+           "Drawing Line from Point{1, 1} to Point{8, 9}\n"
+           "Drawing Rectangle at Point{6, 7} with dimensions (width: 7, height: 7)\n");
+}
+
+TEST_CASE("ShapeArena - shapes of one type are contiguous")
+{
+    ShapeArena arena;
+
+    auto c1 = arena.create<Circle>(1, 1, 1);
+    auto r1 = arena.create<Rectangle>(1, 1, 1, 1);
+    auto c2 = arena.create<Circle>(2, 2, 2);
+    auto r2 = arena.create<Rectangle>(2, 2, 2, 2);
+
+    CHECK(c2.get() == c1.get() + 1);
+    CHECK(r2.get() == r1.get() + 1);
+    CHECK(arena.slab_count() == 2);
+
+    SECTION("new slab is allocated when slab is full")
+    {
+        std::vector<ArenaPtr<Circle>> circles;
+        for (size_t i = 2; i < ShapeArena::slab_capacity; ++i)
+            circles.push_back(arena.create<Circle>());
+        CHECK(arena.slab_count() == 2);
+
+        circles.push_back(arena.create<Circle>());
+        CHECK(arena.slab_count() == 3);
+        CHECK(arena.size() == ShapeArena::slab_capacity + 3);
+    }
+}
+
+TEST_CASE("ArenaPtr")
+{
+    ShapeArena arena;
+
+    ArenaPtr<Circle> circle = arena.create<Circle>(1, 2, 3);
+    Circle* raw_circle = circle.get();
+
+    SECTION("converts to pointer to base")
+    {
+        ArenaPtr<Shape> shape = std::move(circle);
+        CHECK(circle.get() == nullptr);
+        CHECK(shape.get() == raw_circle);
+    }
+
+    SECTION("move assignment")
+    {
+        ArenaPtr<Circle> other = arena.create<Circle>(4, 5, 6);
+        other = std::move(circle);
+        CHECK(!circle);
+        CHECK(other.get() == raw_circle);
+        CHECK(other->radius() == 3);
+    }
+}
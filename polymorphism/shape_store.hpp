@@ -0,0 +1,288 @@
+#ifndef SHAPE_STORE_HPP
+#define SHAPE_STORE_HPP
+
+#include "../vector/numeric_vector.hpp"
+#include "shape.hpp"
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+
+namespace Drawing
+{
+    enum class ShapeKind : uint8_t
+    {
+        circle,
+        rectangle,
+        line
+    };
+
+    // identifies a shape in ShapeStore - index into columns of its kind
+    struct ShapeHandle
+    {
+        ShapeKind kind;
+        uint32_t index;
+
+        bool operator==(const ShapeHandle&) const = default;
+    };
+
+    // Shapes stored as structure of arrays - one column per attribute of each kind
+    // - no virtual calls & no pointer chasing - bulk operations stream through contiguous columns
+    // - move_all & move of one kind translate coordinate columns with SIMD kernels
+    // - shapes are not removed, so handles stay valid
+    class ShapeStore
+    {
+    public:
+        template <typename T>
+        using Column = ModernCpp::NumericVector<T>;
+
+        struct Circles
+        {
+            Column<int> x, y;
+            Column<uint16_t> radius;
+        };
+
+        struct Rectangles
+        {
+            Column<int> x, y;
+            Column<uint16_t> width, height;
+        };
+
+        struct Lines
+        {
+            Column<int> x, y, end_x, end_y;
+        };
+
+        ShapeHandle add_circle(int x, int y, uint16_t radius)
+        {
+            circles_.x.push_back(x);
+            circles_.y.push_back(y);
+            circles_.radius.push_back(radius);
+            return {ShapeKind::circle, static_cast<uint32_t>(circles_.x.size() - 1)};
+        }
+
+        ShapeHandle add_rectangle(int x, int y, uint16_t width, uint16_t height)
+        {
+            rectangles_.x.push_back(x);
+            rectangles_.y.push_back(y);
+            rectangles_.width.push_back(width);
+            rectangles_.height.push_back(height);
+            return {ShapeKind::rectangle, static_cast<uint32_t>(rectangles_.x.size() - 1)};
+        }
+
+        ShapeHandle add_line(int x, int y, int end_x, int end_y)
+        {
+            lines_.x.push_back(x);
+            lines_.y.push_back(y);
+            lines_.end_x.push_back(end_x);
+            lines_.end_y.push_back(end_y);
+            return {ShapeKind::line, static_cast<uint32_t>(lines_.x.size() - 1)};
+        }
+
+        void reserve(size_t circles, size_t rectangles, size_t lines)
+        {
+            reserve_columns(circles, circles_.x, circles_.y, circles_.radius);
+            reserve_columns(rectangles, rectangles_.x, rectangles_.y, rectangles_.width, rectangles_.height);
+            reserve_columns(lines, lines_.x, lines_.y, lines_.end_x, lines_.end_y);
+        }
+
+        size_t size() const noexcept
+        {
+            return circles_.x.size() + rectangles_.x.size() + lines_.x.size();
+        }
+
+        size_t size(ShapeKind kind) const noexcept
+        {
+            switch (kind)
+            {
+            case ShapeKind::circle:
+                return circles_.x.size();
+            case ShapeKind::rectangle:
+                return rectangles_.x.size();
+            case ShapeKind::line:
+                return lines_.x.size();
+            }
+            return 0;
+        }
+
+        // columns - read-only, so sizes of columns of a kind stay equal
+        const Circles& circles() const noexcept
+        {
+            return circles_;
+        }
+
+        const Rectangles& rectangles() const noexcept
+        {
+            return rectangles_;
+        }
+
+        const Lines& lines() const noexcept
+        {
+            return lines_;
+        }
+
+        // translates every shape
+        void move_all(int dx, int dy)
+        {
+            move(ShapeKind::circle, dx, dy);
+            move(ShapeKind::rectangle, dx, dy);
+            move(ShapeKind::line, dx, dy);
+        }
+
+        // translates all shapes of one kind
+        void move(ShapeKind kind, int dx, int dy)
+        {
+            switch (kind)
+            {
+            case ShapeKind::circle:
+                translate(circles_.x, dx);
+                translate(circles_.y, dy);
+                break;
+            case ShapeKind::rectangle:
+                translate(rectangles_.x, dx);
+                translate(rectangles_.y, dy);
+                break;
+            case ShapeKind::line:
+                translate(lines_.x, dx);
+                translate(lines_.y, dy);
+                translate(lines_.end_x, dx);
+                translate(lines_.end_y, dy);
+                break;
+            }
+        }
+
+        // translates a single shape
+        void move(ShapeHandle shape, int dx, int dy)
+        {
+            Column<int>& x = x_column(*this, shape.kind);
+            Column<int>& y = y_column(*this, shape.kind);
+            assert(shape.index < x.size());
+
+            x[shape.index] += dx;
+            y[shape.index] += dy;
+            if (shape.kind == ShapeKind::line)
+            {
+                lines_.end_x[shape.index] += dx;
+                lines_.end_y[shape.index] += dy;
+            }
+        }
+
+        // translates a subset of shapes
+        void move(std::span<const ShapeHandle> shapes, int dx, int dy)
+        {
+            for (const ShapeHandle shape : shapes)
+                move(shape, dx, dy);
+        }
+
+        Point position(ShapeHandle shape) const
+        {
+            const Column<int>& x = x_column(*this, shape.kind);
+            const Column<int>& y = y_column(*this, shape.kind);
+            assert(shape.index < x.size());
+
+            return Point{x[shape.index], y[shape.index]};
+        }
+
+        // polymorphic copy of a shape - for code using Shape interface
+        std::unique_ptr<Shape> make_shape(ShapeHandle shape) const
+        {
+            const uint32_t i = shape.index;
+            switch (shape.kind)
+            {
+            case ShapeKind::circle:
+                return std::make_unique<Circle>(circles_.x[i], circles_.y[i], circles_.radius[i]);
+            case ShapeKind::rectangle:
+                return std::make_unique<Rectangle>(rectangles_.x[i], rectangles_.y[i], rectangles_.width[i], rectangles_.height[i]);
+            case ShapeKind::line:
+                return std::make_unique<Line>(lines_.x[i], lines_.y[i], lines_.end_x[i], lines_.end_y[i]);
+            }
+            return nullptr;
+        }
+
+        // writes description of shape to std::cout (stream is not flushed)
+        void draw(ShapeHandle shape) const
+        {
+            TextRenderSink& sink = cout_render_sink();
+            draw(shape, sink);
+            sink.flush();
+        }
+
+        // sends a single shape to sink - straight from columns
+        void draw(ShapeHandle shape, RenderSink& sink) const
+        {
+            const uint32_t i = shape.index;
+            switch (shape.kind)
+            {
+            case ShapeKind::circle:
+                sink.circle(Point{circles_.x[i], circles_.y[i]}, circles_.radius[i]);
+                break;
+            case ShapeKind::rectangle:
+                sink.rectangle(Point{rectangles_.x[i], rectangles_.y[i]}, rectangles_.width[i], rectangles_.height[i]);
+                break;
+            case ShapeKind::line:
+                sink.line(Point{lines_.x[i], lines_.y[i]}, Point{lines_.end_x[i], lines_.end_y[i]});
+                break;
+            }
+        }
+
+        // sends all shapes to sink - kind by kind, straight from columns
+        void draw_all(RenderSink& sink) const
+        {
+            for (size_t i = 0; i < circles_.x.size(); ++i)
+                sink.circle(Point{circles_.x[i], circles_.y[i]}, circles_.radius[i]);
+            for (size_t i = 0; i < rectangles_.x.size(); ++i)
+                sink.rectangle(Point{rectangles_.x[i], rectangles_.y[i]}, rectangles_.width[i], rectangles_.height[i]);
+            for (size_t i = 0; i < lines_.x.size(); ++i)
+                sink.line(Point{lines_.x[i], lines_.y[i]}, Point{lines_.end_x[i], lines_.end_y[i]});
+        }
+
+    private:
+        Circles circles_;
+        Rectangles rectangles_;
+        Lines lines_;
+
+        static void translate(Column<int>& coords, int delta)
+        {
+            ModernCpp::Simd::offset(coords.begin(), delta, coords.begin(), coords.size());
+        }
+
+        template <typename... Columns>
+        static void reserve_columns(size_t n, Columns&... columns)
+        {
+            (columns.reserve(n), ...);
+        }
+
+        // Self is ShapeStore or const ShapeStore
+        template <typename Self>
+        static auto x_column(Self& self, ShapeKind kind) noexcept -> decltype((self.circles_.x))
+        {
+            switch (kind)
+            {
+            case ShapeKind::circle:
+                return self.circles_.x;
+            case ShapeKind::rectangle:
+                return self.rectangles_.x;
+            default:
+                return self.lines_.x;
+            }
+        }
+
+        template <typename Self>
+        static auto y_column(Self& self, ShapeKind kind) noexcept -> decltype((self.circles_.y))
+        {
+            switch (kind)
+            {
+            case ShapeKind::circle:
+                return self.circles_.y;
+            case ShapeKind::rectangle:
+                return self.rectangles_.y;
+            default:
+                return self.lines_.y;
+            }
+        }
+    };
+} // namespace Drawing
+
+#endif // SHAPE_STORE_HPP
@@ -0,0 +1,69 @@
+#include "shape_store.hpp"
+
+#include <algorithm>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <memory>
+#include <random>
+#include <vector>
+
+// Benchmarks of ShapeStore compared with a vector of polymorphic objects
+
+TEST_CASE("ShapeStore - move_all vs virtual move", "[ShapeStore]")
+{
+    using namespace Drawing;
+
+    constexpr int n = 1'000'000;
+
+    // same scene in both representations - circles, rectangles & lines mixed
+    std::vector<std::unique_ptr<Shape>> shapes;
+    shapes.reserve(n);
+    ShapeStore store;
+    store.reserve(n / 3 + 1, n / 3 + 1, n / 3 + 1);
+    for (int i = 0; i < n; ++i)
+    {
+        switch (i % 3)
+        {
+        case 0:
+            shapes.push_back(std::make_unique<Circle>(i, i, 10));
+            store.add_circle(i, i, 10);
+            break;
+        case 1:
+            shapes.push_back(std::make_unique<Rectangle>(i, i, 10, 20));
+            store.add_rectangle(i, i, 10, 20);
+            break;
+        default:
+            shapes.push_back(std::make_unique<Line>(i, i, i + 10, i + 10));
+            store.add_line(i, i, i + 10, i + 10);
+        }
+    }
+
+    BENCHMARK("vector<unique_ptr<Shape>> - move (allocation order)")
+    {
+        for (const auto& shp : shapes)
+            shp->move(1, 2);
+        return shapes.size();
+    };
+
+    // scene edited over time - objects are no longer visited in address order
+    std::ranges::shuffle(shapes, std::mt19937{42});
+
+    BENCHMARK("vector<unique_ptr<Shape>> - move (shuffled)")
+    {
+        for (const auto& shp : shapes)
+            shp->move(1, 2);
+        return shapes.size();
+    };
+
+    BENCHMARK("ShapeStore - move_all")
+    {
+        store.move_all(1, 2);
+        return store.size();
+    };
+
+    BENCHMARK("ShapeStore - move circles")
+    {
+        store.move(ShapeKind::circle, 1, 2);
+        return store.size();
+    };
+}
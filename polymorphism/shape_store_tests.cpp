@@ -0,0 +1,84 @@
+#include "shape_store.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <sstream>
+#include <vector>
+
+TEST_CASE("ShapeStore")
+{
+    using namespace Drawing;
+
+    ShapeStore store;
+
+    const ShapeHandle circle = store.add_circle(10, 20, 50);
+    const ShapeHandle rect = store.add_rectangle(77, 99, 100, 200);
+    const ShapeHandle line = store.add_line(10, 20, 60, 70);
+
+    // enough shapes of one kind for full SIMD batches & a tail
+    std::vector<ShapeHandle> circles{circle};
+    for (int i = 1; i < 37; ++i)
+        circles.push_back(store.add_circle(i, -i, 5));
+
+    REQUIRE(store.size() == 39);
+    REQUIRE(store.size(ShapeKind::circle) == 37);
+
+    SECTION("handles")
+    {
+        CHECK(store.position(rect).x == 77);
+        CHECK(store.position(rect).y == 99);
+        CHECK(store.circles().radius[circle.index] == 50);
+        CHECK(store.rectangles().height[rect.index] == 200);
+
+        store.move(line, 1, 2);
+        CHECK(store.lines().x[0] == 11);
+        CHECK(store.lines().end_y[0] == 72);
+
+        const std::unique_ptr<Shape> shape = store.make_shape(rect);
+        CHECK(dynamic_cast<Rectangle*>(shape.get()) != nullptr);
+        store.draw(circle);
+    }
+
+    SECTION("draw single shapes")
+    {
+        std::ostringstream out;
+        {
+            TextRenderSink sink{out};
+            store.draw(rect, sink);
+            store.draw(line, sink);
+            store.draw(circle, sink);
+        }
+
+        CHECK(out.str()
+            == "Drawing Rectangle at Point{77, 99} with dimensions (width: 100, height: 200)\n"
+               "Drawing Line from Point{10, 20} to Point{60, 70}\n"
+               "Drawing Circle at Point{10, 20} with radius 50\n");
+    }
+
+    SECTION("move_all")
+    {
+        store.move_all(100, 200);
+
+        CHECK(store.position(circle).x == 110);
+        CHECK(store.position(rect).y == 299);
+        CHECK(store.lines().end_x[0] == 160);
+        CHECK(store.lines().end_y[0] == 270);
+        for (int i = 1; i < 37; ++i)
+        {
+            CHECK(store.position(circles[i]).x == i + 100);
+            CHECK(store.position(circles[i]).y == -i + 200);
+        }
+    }
+
+    SECTION("move subset")
+    {
+        store.move(ShapeKind::circle, 1, 1);
+        CHECK(store.position(circles[36]).x == 37);
+        CHECK(store.position(rect).x == 77);
+
+        const std::vector<ShapeHandle> selected{rect, line};
+        store.move(selected, -7, -9);
+        CHECK(store.position(rect).x == 70);
+        CHECK(store.position(line).y == 11);
+        CHECK(store.position(circle).x == 11);
+    }
+}
@@ -0,0 +1,214 @@
+#ifndef SPATIAL_INDEX_HPP
+#define SPATIAL_INDEX_HPP
+
+#include "shape.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+namespace Drawing
+{
+    // Uniform grid over bounding boxes of shapes - answers range & hit-test queries
+    // - a shape is listed in every cell its bounding box overlaps; a query visits only cells overlapping the area
+    // - shapes outside of bounds are kept in border cells, so queries stay correct (only slower)
+    // - update() after move() relinks a shape only if the range of its cells has changed
+    // - shapes are not owned - they must outlive the index
+    class SpatialIndex
+    {
+    public:
+        using ShapeId = uint32_t;
+
+        SpatialIndex(const Box& bounds, int cell_size)
+            : bounds_{bounds}
+            , cell_size_{cell_size}
+        {
+            if (cell_size <= 0 || bounds.max.x < bounds.min.x || bounds.max.y < bounds.min.y)
+                throw std::invalid_argument{"invalid bounds or cell size of spatial index"};
+
+            columns_ = static_cast<size_t>(bounds.max.x - bounds.min.x) / cell_size + 1;
+            rows_ = static_cast<size_t>(bounds.max.y - bounds.min.y) / cell_size + 1;
+            cells_.resize(columns_ * rows_);
+        }
+
+        // bulk load - ids are positions in shapes
+        SpatialIndex(const Box& bounds, int cell_size, const std::vector<std::unique_ptr<Shape>>& shapes)
+            : SpatialIndex(bounds, cell_size)
+        {
+            entries_.reserve(shapes.size());
+            for (const auto& shape : shapes)
+                insert(*shape);
+        }
+
+        ShapeId insert(Shape& shape)
+        {
+            const auto id = static_cast<ShapeId>(entries_.size());
+            entries_.push_back(Entry{&shape, shape.bounding_box()});
+            link(id, cell_range(entries_.back().box));
+            return id;
+        }
+
+        size_t size() const noexcept
+        {
+            return entries_.size();
+        }
+
+        Shape& shape(ShapeId id) const noexcept
+        {
+            return *entries_[id].shape;
+        }
+
+        // bounding box of shape as seen by the index
+        const Box& bounding_box(ShapeId id) const noexcept
+        {
+            return entries_[id].box;
+        }
+
+        // must be called when a shape has been moved or resized outside of the index
+        void update(ShapeId id)
+        {
+            Entry& entry = entries_[id];
+            const Box new_box = entry.shape->bounding_box();
+            const CellRange old_cells = cell_range(entry.box), new_cells = cell_range(new_box);
+            entry.box = new_box;
+
+            if (new_cells == old_cells) // only copies of box are refreshed
+            {
+                for_each_cell(new_cells, [&](std::vector<CellItem>& cell) { find(cell, id)->box = new_box; });
+                return;
+            }
+
+            unlink(id, old_cells);
+            link(id, new_cells);
+        }
+
+        void move(ShapeId id, int dx, int dy)
+        {
+            entries_[id].shape->move(dx, dy);
+            update(id);
+        }
+
+        // appends ids of shapes whose bounding boxes intersect area - each shape is reported once
+        void query_rect(const Box& area, std::vector<ShapeId>& result) const
+        {
+            // shape spanning many cells is reported by the first of its cells visited by the query:
+            // its box starts in this cell or in a cell left of (above) the queried area
+            const CellRange cells = cell_range(area);
+            for (size_t row = cells.first_row; row <= cells.last_row; ++row)
+            {
+                const bool is_first_row = row == cells.first_row;
+                const int row_min_y = cell_min(row, bounds_.min.y);
+
+                for (size_t column = cells.first_column; column <= cells.last_column; ++column)
+                {
+                    const bool is_first_column = column == cells.first_column;
+                    const int column_min_x = cell_min(column, bounds_.min.x);
+
+                    for (const auto& [box, id] : cells_[row * columns_ + column])
+                    {
+                        if (box.intersects(area) && (is_first_column || box.min.x >= column_min_x) && (is_first_row || box.min.y >= row_min_y))
+                            result.push_back(id);
+                    }
+                }
+            }
+        }
+
+        // appends ids of shapes whose bounding boxes contain pt
+        void query_point(const Point& pt, std::vector<ShapeId>& result) const
+        {
+            for (const auto& [box, id] : cells_[row_of(pt.y) * columns_ + column_of(pt.x)])
+                if (box.contains(pt))
+                    result.push_back(id);
+        }
+
+    private:
+        struct Entry
+        {
+            Shape* shape;
+            Box box;
+        };
+
+        struct CellRange
+        {
+            size_t first_column, last_column, first_row, last_row;
+
+            bool operator==(const CellRange&) const = default;
+        };
+
+        // copy of box is kept in cells - queries read cells sequentially, without visiting entries
+        struct CellItem
+        {
+            Box box;
+            ShapeId id;
+        };
+
+        Box bounds_;
+        int cell_size_;
+        size_t columns_{}, rows_{};
+        std::vector<Entry> entries_;
+        std::vector<std::vector<CellItem>> cells_; // row-major - shapes overlapping each cell
+
+        static size_t cell_of(int coord, int origin, int cell_size, size_t count) noexcept
+        {
+            if (coord <= origin)
+                return 0;
+            return std::min(static_cast<size_t>((static_cast<int64_t>(coord) - origin) / cell_size), count - 1);
+        }
+
+        // first coordinate in cell - cell 0 includes everything before origin
+        int cell_min(size_t cell, int origin) const noexcept
+        {
+            return cell == 0 ? std::numeric_limits<int>::min() : origin + static_cast<int>(cell) * cell_size_;
+        }
+
+        size_t column_of(int x) const noexcept
+        {
+            return cell_of(x, bounds_.min.x, cell_size_, columns_);
+        }
+
+        size_t row_of(int y) const noexcept
+        {
+            return cell_of(y, bounds_.min.y, cell_size_, rows_);
+        }
+
+        CellRange cell_range(const Box& box) const noexcept
+        {
+            return {column_of(box.min.x), column_of(box.max.x), row_of(box.min.y), row_of(box.max.y)};
+        }
+
+        template <typename Action>
+        void for_each_cell(const CellRange& cells, Action action)
+        {
+            for (size_t row = cells.first_row; row <= cells.last_row; ++row)
+                for (size_t column = cells.first_column; column <= cells.last_column; ++column)
+                    action(cells_[row * columns_ + column]);
+        }
+
+        static std::vector<CellItem>::iterator find(std::vector<CellItem>& cell, ShapeId id) noexcept
+        {
+            const auto it = std::ranges::find(cell, id, &CellItem::id);
+            assert(it != cell.end());
+            return it;
+        }
+
+        void link(ShapeId id, const CellRange& cells)
+        {
+            for_each_cell(cells, [&](std::vector<CellItem>& cell) { cell.push_back(CellItem{entries_[id].box, id}); });
+        }
+
+        void unlink(ShapeId id, const CellRange& cells) noexcept
+        {
+            for_each_cell(cells, [&](std::vector<CellItem>& cell) {
+                *find(cell, id) = cell.back(); // order of items in a cell does not matter
+                cell.pop_back();
+            });
+        }
+    };
+} // namespace Drawing
+
+#endif // SPATIAL_INDEX_HPP
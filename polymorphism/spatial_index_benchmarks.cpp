@@ -0,0 +1,103 @@
+#include "spatial_index.hpp"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+    // runs query for each of points and prints number of queries per second
+    template <typename Query>
+    void report_queries_per_second(const std::string& name, const std::vector<Drawing::Point>& points, Query query)
+    {
+        using namespace std::chrono;
+
+        size_t results = 0;
+        const auto start = steady_clock::now();
+        for (const auto& pt : points)
+            results += query(pt);
+        const double seconds = duration<double>(steady_clock::now() - start).count();
+
+        std::cout << std::left << std::setw(48) << name << std::fixed << std::setprecision(0)
+                  << (static_cast<double>(points.size()) / seconds) << " queries/s ("
+                  << std::setprecision(1) << static_cast<double>(results) / points.size() << " shapes per query)\n";
+    }
+} // namespace
+
+TEST_CASE("SpatialIndex - 1M shapes", "[SpatialIndex]")
+{
+    using namespace Drawing;
+
+    constexpr int n = 1'000'000;
+    constexpr int world_size = 100'000;
+    constexpr int viewport_size = 1'000;
+
+    std::mt19937 rnd{42};
+    std::uniform_int_distribution<int> coord{0, world_size - 1};
+    std::uniform_int_distribution<int> size{1, 200};
+
+    std::vector<std::unique_ptr<Shape>> shapes;
+    shapes.reserve(n);
+    for (int i = 0; i < n; ++i)
+    {
+        const int x = coord(rnd), y = coord(rnd);
+        if (i % 3 == 0)
+            shapes.push_back(std::make_unique<Circle>(x, y, size(rnd)));
+        else if (i % 3 == 1)
+            shapes.push_back(std::make_unique<Rectangle>(x, y, size(rnd), size(rnd)));
+        else
+            shapes.push_back(std::make_unique<Line>(x, y, x + size(rnd), y - size(rnd)));
+    }
+
+    const Box world{{0, 0}, {world_size - 1, world_size - 1}};
+
+    const auto build_start = std::chrono::steady_clock::now();
+    // cells about half of the viewport - a query visits 3x3 cells
+    SpatialIndex index{world, 512, shapes};
+    std::cout << "bulk load of " << n << " shapes: "
+              << std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - build_start).count() << " ms\n";
+
+    std::vector<Point> points(100'000);
+    for (auto& pt : points)
+        pt = Point{coord(rnd), coord(rnd)};
+
+    std::vector<SpatialIndex::ShapeId> found;
+
+    // target: at least 100K queries per second
+    report_queries_per_second("SpatialIndex::query_rect (1000x1000 viewport)", points, [&](Point pt) {
+        found.clear();
+        index.query_rect(Box{pt, {pt.x + viewport_size, pt.y + viewport_size}}, found);
+        return found.size();
+    });
+
+    report_queries_per_second("SpatialIndex::query_point", points, [&](Point pt) {
+        found.clear();
+        index.query_point(pt, found);
+        return found.size();
+    });
+
+    const std::vector<Point> few_points(points.begin(), points.begin() + 100);
+    report_queries_per_second("linear scan (1000x1000 viewport)", few_points, [&](Point pt) {
+        const Box viewport{pt, {pt.x + viewport_size, pt.y + viewport_size}};
+        size_t count = 0;
+        for (const auto& shp : shapes)
+            count += shp->bounding_box().intersects(viewport);
+        return count;
+    });
+
+    std::uniform_int_distribution<SpatialIndex::ShapeId> any_shape{0, n - 1};
+    std::uniform_int_distribution<int> delta{-50, 50};
+
+    BENCHMARK("SpatialIndex::move - 10K random shapes")
+    {
+        for (int i = 0; i < 10'000; ++i)
+            index.move(any_shape(rnd), delta(rnd), delta(rnd));
+        return index.size();
+    };
+}
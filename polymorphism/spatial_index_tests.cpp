@@ -0,0 +1,124 @@
+#include "spatial_index.hpp"
+
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace
+{
+    using Drawing::Box, Drawing::Point, Drawing::Shape, Drawing::SpatialIndex;
+
+    std::vector<std::unique_ptr<Shape>> make_scene(size_t n, std::mt19937& rnd)
+    {
+        using namespace Drawing;
+
+        // some shapes lie outside of bounds of the index
+        std::uniform_int_distribution<int> coord{-100, 1100};
+        std::uniform_int_distribution<int> size{0, 80};
+
+        std::vector<std::unique_ptr<Shape>> shapes;
+        for (size_t i = 0; i < n; ++i)
+        {
+            const int x = coord(rnd), y = coord(rnd);
+            switch (i % 4)
+            {
+            case 0:
+                shapes.push_back(std::make_unique<Circle>(x, y, size(rnd)));
+                break;
+            case 1:
+                shapes.push_back(std::make_unique<Rectangle>(x, y, size(rnd), size(rnd)));
+                break;
+            case 2:
+                shapes.push_back(std::make_unique<Line>(x, y, x - size(rnd), y + size(rnd)));
+                break;
+            default:
+                shapes.push_back(std::make_unique<Square>(x, y, size(rnd)));
+            }
+        }
+        return shapes;
+    }
+
+    // linear scan
+    template <typename Predicate>
+    std::vector<SpatialIndex::ShapeId> expected_ids(const std::vector<std::unique_ptr<Shape>>& shapes, Predicate pred)
+    {
+        std::vector<SpatialIndex::ShapeId> result;
+        for (size_t i = 0; i < shapes.size(); ++i)
+            if (pred(shapes[i]->bounding_box()))
+                result.push_back(static_cast<SpatialIndex::ShapeId>(i));
+        return result;
+    }
+
+    std::vector<SpatialIndex::ShapeId> sorted(std::vector<SpatialIndex::ShapeId> ids)
+    {
+        std::ranges::sort(ids);
+        return ids;
+    }
+} // namespace
+
+TEST_CASE("Shape - bounding_box")
+{
+    using namespace Drawing;
+
+    CHECK(Circle{10, 20, 5}.bounding_box() == Box{{5, 15}, {15, 25}});
+    CHECK(Rectangle{10, 20, 30, 40}.bounding_box() == Box{{10, 20}, {40, 60}});
+    CHECK(Line{10, 20, -5, 30}.bounding_box() == Box{{-5, 20}, {10, 30}});
+    CHECK(Square{1, 2, 3}.bounding_box() == Box{{1, 2}, {4, 5}});
+}
+
+TEST_CASE("SpatialIndex")
+{
+    std::mt19937 rnd{665};
+    const auto shapes = make_scene(2'000, rnd);
+
+    SpatialIndex index{Box{{0, 0}, {999, 999}}, 64, shapes};
+    REQUIRE(index.size() == shapes.size());
+
+    std::uniform_int_distribution<int> coord{-150, 1150};
+    std::vector<SpatialIndex::ShapeId> found;
+
+    const auto check_queries = [&] {
+        for (int i = 0; i < 200; ++i)
+        {
+            const Point corner{coord(rnd), coord(rnd)};
+            const Box area{corner, {corner.x + i, corner.y + 2 * i}};
+
+            found.clear();
+            index.query_rect(area, found);
+            REQUIRE(sorted(found) == expected_ids(shapes, [&](const Box& box) { return box.intersects(area); }));
+
+            found.clear();
+            index.query_point(corner, found);
+            REQUIRE(sorted(found) == expected_ids(shapes, [&](const Box& box) { return box.contains(corner); }));
+        }
+    };
+
+    SECTION("queries match linear scan")
+    {
+        check_queries();
+    }
+
+    SECTION("incremental updates")
+    {
+        std::uniform_int_distribution<int> delta{-300, 300};
+
+        for (SpatialIndex::ShapeId id = 0; id < shapes.size(); id += 3)
+            index.move(id, delta(rnd), delta(rnd));
+
+        // moved without the index
+        for (SpatialIndex::ShapeId id = 1; id < shapes.size(); id += 3)
+        {
+            shapes[id]->move(delta(rnd), delta(rnd));
+            index.update(id);
+        }
+
+        check_queries();
+    }
+
+    SECTION("invalid cell size")
+    {
+        CHECK_THROWS_AS((SpatialIndex{Box{{0, 0}, {10, 10}}, 0}), std::invalid_argument);
+    }
+}
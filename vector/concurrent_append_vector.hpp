@@ -0,0 +1,313 @@
+#ifndef CONCURRENT_APPEND_VECTOR_HPP
+#define CONCURRENT_APPEND_VECTOR_HPP
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <compare>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace ModernCpp
+{
+    // Append-only vector for many producer threads
+    // - producers reserve slots with atomic fetch_add - no locks
+    // - items are stored in chunks of growing size (first_chunk_capacity, 2x, 4x, ...) - existing items never move
+    // - size() is the published prefix - all items below it are fully constructed and visible to the reader
+    // - an item is constructed before its slot is reserved, so exceptions thrown by T leave no holes
+    //   (failure to allocate a chunk after reservation terminates the program)
+    template <typename T>
+    class ConcurrentAppendVector
+    {
+        static_assert(std::is_nothrow_move_constructible_v<T>, "items are moved into reserved slots");
+
+        struct Slot
+        {
+            union
+            {
+                T value;
+            };
+            std::atomic<bool> ready{false};
+
+            Slot() noexcept
+            {
+            }
+
+            ~Slot()
+            {
+            }
+        };
+
+        class ConstIterator;
+
+    public:
+        using value_type = T;
+        using const_iterator = ConstIterator;
+        using iterator = const_iterator;
+
+        // power of 2 - chunk & offset are computed with bit operations
+        static constexpr size_t first_chunk_capacity = std::bit_floor(std::max<size_t>(1, 4096 / sizeof(Slot)));
+
+        ConcurrentAppendVector() noexcept = default;
+
+        ConcurrentAppendVector(const ConcurrentAppendVector&) = delete;
+        ConcurrentAppendVector& operator=(const ConcurrentAppendVector&) = delete;
+
+        // must not be called while producers are running
+        ~ConcurrentAppendVector()
+        {
+            const size_t reserved = reserved_.load(std::memory_order_acquire);
+            for (size_t chunk = 0; chunk < chunks_.size(); ++chunk)
+            {
+                Slot* slots = chunks_[chunk].load(std::memory_order_acquire);
+                if (!slots)
+                    continue;
+
+                const size_t first = chunk_begin(chunk);
+                const size_t count = std::min(chunk_capacity(chunk), reserved > first ? reserved - first : 0);
+                for (size_t i = 0; i < count; ++i)
+                    if (slots[i].ready.load(std::memory_order_relaxed))
+                        std::destroy_at(&slots[i].value);
+
+                delete[] slots;
+            }
+        }
+
+        // thread safe - returns index of the new item
+        template <typename TItem>
+        size_t push_back(TItem&& item)
+        {
+            return emplace_back(std::forward<TItem>(item));
+        }
+
+        // thread safe - returns index of the new item
+        template <typename... TArgs>
+        size_t emplace_back(TArgs&&... args)
+        {
+            T item(std::forward<TArgs>(args)...);
+            return publish(std::move(item));
+        }
+
+        // allocates chunks for n items up front - thread safe
+        void reserve(size_t n)
+        {
+            for (size_t chunk = 0; n > 0 && chunk_begin(chunk) < n; ++chunk)
+                acquire_chunk(chunk);
+        }
+
+        // number of published items - items [0, size()) may be read
+        size_t size() const noexcept
+        {
+            size_t published = published_.load(std::memory_order_acquire);
+            const size_t reserved = reserved_.load(std::memory_order_acquire);
+
+            size_t end = published;
+            while (end < reserved && is_ready(end))
+                ++end;
+
+            // shared counter is moved forward, so next calls scan only new items
+            while (published < end && !published_.compare_exchange_weak(published, end, std::memory_order_release, std::memory_order_acquire))
+            {
+            }
+
+            return std::max(published, end);
+        }
+
+        bool empty() const noexcept
+        {
+            return size() == 0;
+        }
+
+        // index must be below size() returned earlier to the calling thread
+        const T& operator[](size_t index) const noexcept
+        {
+            const auto [chunk, offset] = locate(index);
+            return chunks_[chunk].load(std::memory_order_acquire)[offset].value;
+        }
+
+        // iteration over items published when begin() is called
+        const_iterator begin() const noexcept
+        {
+            return const_iterator{this, 0};
+        }
+
+        const_iterator end() const noexcept
+        {
+            return const_iterator{this, size()};
+        }
+
+    private:
+        // chunk k holds first_chunk_capacity << k items
+        static constexpr size_t max_chunks = std::numeric_limits<size_t>::digits - std::countr_zero(first_chunk_capacity);
+
+        std::array<std::atomic<Slot*>, max_chunks> chunks_{};
+        std::atomic<size_t> reserved_{};
+        mutable std::atomic<size_t> published_{};
+
+        static constexpr size_t chunk_capacity(size_t chunk) noexcept
+        {
+            return first_chunk_capacity << chunk;
+        }
+
+        static constexpr size_t chunk_begin(size_t chunk) noexcept
+        {
+            return first_chunk_capacity * ((size_t{1} << chunk) - 1);
+        }
+
+        static constexpr std::pair<size_t, size_t> locate(size_t index) noexcept
+        {
+            const size_t chunk = std::bit_width(index / first_chunk_capacity + 1) - 1;
+            return {chunk, index - chunk_begin(chunk)};
+        }
+
+        size_t publish(T&& item) noexcept
+        {
+            const size_t index = reserved_.fetch_add(1, std::memory_order_relaxed);
+            const auto [chunk, offset] = locate(index);
+
+            Slot& slot = acquire_chunk(chunk)[offset];
+            std::construct_at(&slot.value, std::move(item));
+            slot.ready.store(true, std::memory_order_release);
+
+            return index;
+        }
+
+        // returns chunk - it is allocated by the first thread which needs it
+        Slot* acquire_chunk(size_t chunk)
+        {
+            Slot* slots = chunks_[chunk].load(std::memory_order_acquire);
+            if (slots)
+                return slots;
+
+            Slot* new_slots = new Slot[chunk_capacity(chunk)];
+            if (chunks_[chunk].compare_exchange_strong(slots, new_slots, std::memory_order_acq_rel, std::memory_order_acquire))
+                return new_slots;
+
+            delete[] new_slots; // other thread was first
+            return slots;
+        }
+
+        bool is_ready(size_t index) const noexcept
+        {
+            const auto [chunk, offset] = locate(index);
+            const Slot* slots = chunks_[chunk].load(std::memory_order_acquire);
+            return slots && slots[offset].ready.load(std::memory_order_acquire);
+        }
+    };
+
+    // random access iterator - reads items by index
+    template <typename T>
+    class ConcurrentAppendVector<T>::ConstIterator
+    {
+    public:
+        using iterator_concept = std::random_access_iterator_tag;
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T*;
+        using reference = const T&;
+
+        ConstIterator() noexcept = default;
+
+        ConstIterator(const ConcurrentAppendVector* vector, size_t index) noexcept
+            : vector_{vector}
+            , index_{index}
+        {
+        }
+
+        reference operator*() const noexcept
+        {
+            return (*vector_)[index_];
+        }
+
+        pointer operator->() const noexcept
+        {
+            return &**this;
+        }
+
+        reference operator[](difference_type n) const noexcept
+        {
+            return *(*this + n);
+        }
+
+        ConstIterator& operator++() noexcept
+        {
+            ++index_;
+            return *this;
+        }
+
+        ConstIterator operator++(int) noexcept
+        {
+            ConstIterator temp = *this;
+            ++index_;
+            return temp;
+        }
+
+        ConstIterator& operator--() noexcept
+        {
+            --index_;
+            return *this;
+        }
+
+        ConstIterator operator--(int) noexcept
+        {
+            ConstIterator temp = *this;
+            --index_;
+            return temp;
+        }
+
+        ConstIterator& operator+=(difference_type n) noexcept
+        {
+            index_ += n;
+            return *this;
+        }
+
+        ConstIterator& operator-=(difference_type n) noexcept
+        {
+            index_ -= n;
+            return *this;
+        }
+
+        friend ConstIterator operator+(ConstIterator it, difference_type n) noexcept
+        {
+            return it += n;
+        }
+
+        friend ConstIterator operator+(difference_type n, ConstIterator it) noexcept
+        {
+            return it += n;
+        }
+
+        friend ConstIterator operator-(ConstIterator it, difference_type n) noexcept
+        {
+            return it -= n;
+        }
+
+        friend difference_type operator-(const ConstIterator& a, const ConstIterator& b) noexcept
+        {
+            return static_cast<difference_type>(a.index_) - static_cast<difference_type>(b.index_);
+        }
+
+        friend bool operator==(const ConstIterator& a, const ConstIterator& b) noexcept
+        {
+            return a.index_ == b.index_;
+        }
+
+        friend auto operator<=>(const ConstIterator& a, const ConstIterator& b) noexcept
+        {
+            return a.index_ <=> b.index_;
+        }
+
+    private:
+        const ConcurrentAppendVector* vector_{};
+        size_t index_{};
+    };
+} // namespace ModernCpp
+
+#endif // CONCURRENT_APPEND_VECTOR_HPP
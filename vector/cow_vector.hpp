@@ -0,0 +1,290 @@
+#ifndef COW_VECTOR_HPP
+#define COW_VECTOR_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <initializer_list>
+#include <utility>
+
+#include "vector.hpp"
+
+namespace ModernCpp
+{
+    // Copy-on-write Vector - copies share one refcounted buffer
+    // - copying is O(1), so read-only snapshots can be passed by value
+    // - first mutating access (non-const begin/end/operator[], push_back, ...) to a shared buffer detaches a private copy
+    // - handing out a mutable reference/iterator (non-const begin/end/operator[], emplace_back) marks the buffer unshareable - copies are deep until it is reallocated
+    // - refcount is atomic - snapshots may be used by other threads (each CowVector object by one thread at a time)
+    template <typename T>
+    class CowVector
+    {
+    public:
+        using value_type = T;
+        using iterator = T*;
+        using const_iterator = const T*;
+
+        CowVector() noexcept = default;
+
+        explicit CowVector(size_t size)
+            : buffer_{new Buffer{Vector<T>(size)}}
+        {
+        }
+
+        CowVector(std::initializer_list<T> items)
+            : buffer_{new Buffer{Vector<T>(items)}}
+        {
+        }
+
+        // adopts items - no copy is made
+        explicit CowVector(Vector<T>&& items)
+            : buffer_{new Buffer{std::move(items)}}
+        {
+        }
+
+        // copy constructor - buffer is shared unless mutable references to it may exist
+        CowVector(const CowVector& source)
+        {
+            if (!source.buffer_)
+                return;
+
+            if (source.buffer_->shareable)
+            {
+                buffer_ = source.buffer_;
+                buffer_->ref_count.fetch_add(1, std::memory_order_relaxed);
+            }
+            else
+            {
+                CowVector copy = source.detached_copy(source.capacity());
+                swap(copy);
+            }
+        }
+
+        // copy assignment
+        CowVector& operator=(const CowVector& source)
+        {
+            CowVector temp(source);
+            swap(temp);
+
+            return *this;
+        }
+
+        // move constructor
+        CowVector(CowVector&& source) noexcept
+            : buffer_{std::exchange(source.buffer_, nullptr)}
+        {
+        }
+
+        // move assignment
+        CowVector& operator=(CowVector&& source) noexcept
+        {
+            if (this != &source) // avoiding self assignment
+            {
+                CowVector temp(std::move(source));
+                swap(temp);
+            }
+
+            return *this;
+        }
+
+        ~CowVector() noexcept
+        {
+            release();
+        }
+
+        void swap(CowVector& that) noexcept
+        {
+            std::swap(this->buffer_, that.buffer_);
+        }
+
+        // true if buffer is shared with other copies - next mutating access makes a copy
+        bool is_shared() const noexcept
+        {
+            // acquire - reads made through released copies happen before writes to a buffer that became unique
+            return buffer_ && buffer_->ref_count.load(std::memory_order_acquire) > 1;
+        }
+
+        size_t size() const noexcept
+        {
+            return buffer_ ? buffer_->items.size() : 0;
+        }
+
+        size_t capacity() const noexcept
+        {
+            return buffer_ ? buffer_->items.capacity() : 0;
+        }
+
+        bool empty() const noexcept
+        {
+            return size() == 0;
+        }
+
+        void reserve(size_t new_capacity)
+        {
+            if (new_capacity <= capacity())
+                return;
+
+            if (is_shared())
+            {
+                CowVector copy = detached_copy(new_capacity);
+                swap(copy);
+            }
+            else
+            {
+                unique_items().reserve(new_capacity);
+                buffer_->shareable = true; // items were moved - references handed out before are invalid
+            }
+        }
+
+        // read-only view of items - never detaches
+        const Vector<T>& items() const noexcept
+        {
+            return buffer_ ? buffer_->items : empty_items_;
+        }
+
+        iterator begin()
+        {
+            detach_unshareable();
+            return buffer_ ? buffer_->items.begin() : nullptr;
+        }
+
+        iterator end()
+        {
+            detach_unshareable();
+            return buffer_ ? buffer_->items.end() : nullptr;
+        }
+
+        const_iterator begin() const noexcept
+        {
+            return items().begin();
+        }
+
+        const_iterator end() const noexcept
+        {
+            return items().end();
+        }
+
+        const_iterator cbegin() const noexcept
+        {
+            return items().begin();
+        }
+
+        const_iterator cend() const noexcept
+        {
+            return items().end();
+        }
+
+        T& operator[](size_t index)
+        {
+            detach_unshareable();
+            return buffer_->items[index];
+        }
+
+        const T& operator[](size_t index) const noexcept
+        {
+            return buffer_->items[index];
+        }
+
+        bool operator==(const CowVector& that) const
+        {
+            return buffer_ == that.buffer_ || items() == that.items();
+        }
+
+        // no reference is handed out - buffer stays shareable
+        template <typename TItem>
+        void push_back(TItem&& item)
+        {
+            append(std::forward<TItem>(item));
+        }
+
+        template <typename... TArgs>
+        T& emplace_back(TArgs&&... args)
+        {
+            T& item = append(std::forward<TArgs>(args)...);
+            buffer_->shareable = false;
+            return item;
+        }
+
+    private:
+        struct Buffer
+        {
+            Vector<T> items;
+            std::atomic<size_t> ref_count{1};
+            bool shareable{true}; // false once a mutable reference was handed out - written only while buffer is unique
+        };
+
+        inline static const Vector<T> empty_items_{};
+
+        Buffer* buffer_{};
+
+        size_t next_capacity() const noexcept
+        {
+            return capacity() == 0 ? 1 : capacity() * Vector<T>::growth_factor;
+        }
+
+        // copy of items in a new (unshared) buffer
+        CowVector detached_copy(size_t capacity) const
+        {
+            Vector<T> items;
+            items.reserve(capacity);
+            items.append_range(this->items());
+
+            return CowVector(std::move(items));
+        }
+
+        // adds item to a unique buffer - a reallocated buffer becomes shareable (references handed out before are invalid)
+        template <typename... TArgs>
+        T& append(TArgs&&... args)
+        {
+            if (!is_shared())
+            {
+                const bool reallocates = size() == capacity();
+                T& item = unique_items().emplace_back(std::forward<TArgs>(args)...);
+                if (reallocates)
+                    buffer_->shareable = true;
+                return item;
+            }
+
+            // args may refer to an item of shared buffer - it is released after the new item is created
+            CowVector copy = detached_copy(size() == capacity() ? next_capacity() : capacity());
+            copy.buffer_->items.emplace_back(std::forward<TArgs>(args)...);
+            swap(copy);
+
+            return buffer_->items[size() - 1];
+        }
+
+        // makes buffer unique before it is modified
+        void detach()
+        {
+            if (is_shared())
+            {
+                CowVector copy = detached_copy(capacity());
+                swap(copy);
+            }
+        }
+
+        // makes buffer unique before a mutable reference/iterator is handed out - copies of it won't share the buffer
+        void detach_unshareable()
+        {
+            detach();
+            if (buffer_)
+                buffer_->shareable = false;
+        }
+
+        // items of buffer which is not shared - allocated if vector is empty
+        Vector<T>& unique_items()
+        {
+            if (!buffer_)
+                buffer_ = new Buffer{};
+            return buffer_->items;
+        }
+
+        void release() noexcept
+        {
+            // acq_rel - all accesses through other copies happen before the buffer is deleted
+            if (buffer_ && buffer_->ref_count.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                delete buffer_;
+        }
+    };
+} // namespace ModernCpp
+
+#endif // COW_VECTOR_HPP
@@ -0,0 +1,469 @@
+#ifndef MD_VIEW_HPP
+#define MD_VIEW_HPP
+
+#include "numeric_vector.hpp"
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+
+namespace ModernCpp
+{
+    // Layouts of MdView - map indexes to offset in a flat buffer
+
+    // last index is contiguous (C arrays)
+    struct RowMajor
+    {
+        template <size_t Rank>
+        static constexpr std::array<size_t, Rank> strides(const std::array<size_t, Rank>& extents) noexcept
+        {
+            std::array<size_t, Rank> result{};
+            size_t stride = 1;
+            for (size_t r = Rank; r-- > 0;)
+            {
+                result[r] = stride;
+                stride *= extents[r];
+            }
+            return result;
+        }
+    };
+
+    // first index is contiguous (Fortran, BLAS)
+    struct ColumnMajor
+    {
+        template <size_t Rank>
+        static constexpr std::array<size_t, Rank> strides(const std::array<size_t, Rank>& extents) noexcept
+        {
+            std::array<size_t, Rank> result{};
+            size_t stride = 1;
+            for (size_t r = 0; r < Rank; ++r)
+            {
+                result[r] = stride;
+                stride *= extents[r];
+            }
+            return result;
+        }
+    };
+
+    // strides are given explicitly - subviews, transposed views, every n-th row, ...
+    struct Strided
+    {
+    };
+
+    // Non-owning multidimensional view of items (mdspan-like)
+    // - view[i, j] is item at data()[i * stride(0) + j * stride(1)]
+    // - views are cheap to copy - constness of items is part of T
+    template <typename T, size_t Rank, typename Layout = RowMajor>
+    class MdView
+    {
+        static_assert(Rank > 0, "view needs at least one dimension");
+
+    public:
+        using element_type = T;
+        using value_type = std::remove_cv_t<T>;
+        using layout_type = Layout;
+        using Extents = std::array<size_t, Rank>;
+
+        static constexpr size_t rank = Rank;
+
+        MdView() noexcept = default;
+
+        MdView(T* data, const Extents& extents) noexcept
+            requires(!std::same_as<Layout, Strided>)
+            : data_{data}
+            , extents_{extents}
+            , strides_{Layout::strides(extents)}
+        {
+        }
+
+        MdView(T* data, const Extents& extents, const Extents& strides) noexcept
+            requires std::same_as<Layout, Strided>
+            : data_{data}
+            , extents_{extents}
+            , strides_{strides}
+        {
+        }
+
+        // MdView<T> -> MdView<const T> and any layout -> Strided
+        template <typename OtherT, typename OtherLayout>
+            requires std::convertible_to<OtherT (*)[], T (*)[]> && (std::same_as<OtherLayout, Layout> || std::same_as<Layout, Strided>)
+        MdView(const MdView<OtherT, Rank, OtherLayout>& other) noexcept
+            : data_{other.data()}
+            , extents_{other.extents()}
+            , strides_{other.strides()}
+        {
+        }
+
+        T* data() const noexcept
+        {
+            return data_;
+        }
+
+        const Extents& extents() const noexcept
+        {
+            return extents_;
+        }
+
+        const Extents& strides() const noexcept
+        {
+            return strides_;
+        }
+
+        size_t extent(size_t r) const noexcept
+        {
+            return extents_[r];
+        }
+
+        size_t stride(size_t r) const noexcept
+        {
+            return strides_[r];
+        }
+
+        // number of items
+        size_t size() const noexcept
+        {
+            size_t result = 1;
+            for (const size_t extent : extents_)
+                result *= extent;
+            return result;
+        }
+
+        bool empty() const noexcept
+        {
+            return size() == 0;
+        }
+
+        template <std::convertible_to<size_t>... Indexes>
+            requires(sizeof...(Indexes) == Rank)
+        T& operator[](Indexes... indexes) const noexcept
+        {
+            return data_[offset(Extents{static_cast<size_t>(indexes)...})];
+        }
+
+        // block starting at offsets
+        MdView<T, Rank, Strided> subview(const Extents& offsets, const Extents& extents) const noexcept
+        {
+            return {data_ + offset(offsets), extents, strides_};
+        }
+
+        // no items are moved - indexes are swapped
+        MdView<T, 2, Strided> transposed() const noexcept
+            requires(Rank == 2)
+        {
+            return {data_, {extents_[1], extents_[0]}, {strides_[1], strides_[0]}};
+        }
+
+    private:
+        T* data_{};
+        Extents extents_{};
+        Extents strides_{};
+
+        size_t offset(const Extents& indexes) const noexcept
+        {
+            size_t result = 0;
+            for (size_t r = 0; r < Rank; ++r)
+                result += indexes[r] * strides_[r];
+            return result;
+        }
+    };
+
+    template <typename T, typename Layout = RowMajor>
+    using MatrixView = MdView<T, 2, Layout>;
+
+    namespace Detail
+    {
+        template <size_t Rank>
+        void check_extents(size_t size, const std::array<size_t, Rank>& extents)
+        {
+            size_t count = 1;
+            for (const size_t extent : extents)
+                count *= extent;
+            if (count != size)
+                throw std::invalid_argument{"Vector size does not match extents of view"};
+        }
+    } // namespace Detail
+
+    // view of items of a vector - md_view(vec, rows, columns) or md_view<ColumnMajor>(vec, rows, columns)
+    template <typename Layout = RowMajor, typename T, typename Allocator, typename Tracing, std::convertible_to<size_t>... Extents>
+        requires(!std::same_as<Layout, Strided>)
+    MdView<T, sizeof...(Extents), Layout> md_view(Vector<T, Allocator, Tracing>& items, Extents... extents)
+    {
+        const std::array<size_t, sizeof...(Extents)> sizes{static_cast<size_t>(extents)...};
+        Detail::check_extents(items.size(), sizes);
+        return {items.begin(), sizes};
+    }
+
+    template <typename Layout = RowMajor, typename T, typename Allocator, typename Tracing, std::convertible_to<size_t>... Extents>
+        requires(!std::same_as<Layout, Strided>)
+    MdView<const T, sizeof...(Extents), Layout> md_view(const Vector<T, Allocator, Tracing>& items, Extents... extents)
+    {
+        const std::array<size_t, sizeof...(Extents)> sizes{static_cast<size_t>(extents)...};
+        Detail::check_extents(items.size(), sizes);
+        return {items.begin(), sizes};
+    }
+
+    namespace Simd
+    {
+        namespace Detail
+        {
+            // Blocked matrix multiply (GotoBLAS scheme)
+            // - blocks of A (block_rows x block_depth) & B (block_depth x block_columns) are packed into
+            //   contiguous row-major buffers - any layout of the views is handled by packing
+            // - micro kernel keeps 4 x 2 batches of C in registers while it walks depth of the blocks
+
+            inline constexpr size_t block_rows = 128;
+            inline constexpr size_t block_depth = 256;
+            inline constexpr size_t block_columns = 512;
+            inline constexpr size_t tile_rows = 4;
+
+            // c[tile_rows][2 batches] = a[tile_rows][depth] * b[depth][2 batches] - rows of a, b & c are stride items apart
+            template <size_t Bytes, typename T>
+            [[gnu::always_inline]] inline void multiply_tile(const T* a, const T* b, T* c, size_t depth, size_t a_stride, size_t b_stride, size_t c_stride)
+            {
+                using B = Batch<T, Bytes>;
+
+                // value-initialized - accumulators start at zero & gcc can't prove broadcast() writes the others (-Wmaybe-uninitialized)
+                typename B::type acc[tile_rows][2]{}, x_0{}, x_1{}, factor{};
+
+                for (size_t k = 0; k < depth; ++k)
+                {
+                    B::load(x_0, b + k * b_stride);
+                    B::load(x_1, b + k * b_stride + B::size);
+                    for (size_t r = 0; r < tile_rows; ++r)
+                    {
+                        B::broadcast(factor, a[r * a_stride + k]);
+                        acc[r][0] += factor * x_0;
+                        acc[r][1] += factor * x_1;
+                    }
+                }
+
+                for (size_t r = 0; r < tile_rows; ++r)
+                {
+                    B::store(c + r * c_stride, acc[r][0]);
+                    B::store(c + r * c_stride + B::size, acc[r][1]);
+                }
+            }
+
+            // c = a * b for packed blocks - rows are padded to tile_rows, columns to a whole number of tiles
+            template <size_t Bytes, typename T>
+            [[gnu::always_inline]] inline void multiply_block(const T* a, const T* b, T* c, size_t rows, size_t depth, size_t columns)
+            {
+                constexpr size_t tile_columns = 2 * Batch<T, Bytes>::size;
+
+                // tile of b stays in L1 cache while all rows of a pass by
+                for (size_t j = 0; j < columns; j += tile_columns)
+                    for (size_t i = 0; i < rows; i += tile_rows)
+                        multiply_tile<Bytes>(a + i * depth, b + j, c + i * columns + j, depth, depth, columns, columns);
+            }
+
+#ifdef MODERNCPP_SIMD_X86
+            template <typename T>
+            [[gnu::target("sse2")]] void multiply_block_sse2(const T* a, const T* b, T* c, size_t rows, size_t depth, size_t columns)
+            {
+                multiply_block<16>(a, b, c, rows, depth, columns);
+            }
+
+            template <typename T>
+            [[gnu::target("avx2")]] void multiply_block_avx2(const T* a, const T* b, T* c, size_t rows, size_t depth, size_t columns)
+            {
+                multiply_block<32>(a, b, c, rows, depth, columns);
+            }
+#endif
+        } // namespace Detail
+
+        // c = a * b for packed row-major blocks - columns must be a multiple of 64 bytes, rows of tile_rows
+        template <Arithmetic T>
+        void multiply_block(const T* a, const T* b, T* c, size_t rows, size_t depth, size_t columns, InstructionSet is = instruction_set())
+        {
+#ifdef MODERNCPP_SIMD_X86
+            switch (is)
+            {
+            case InstructionSet::avx2:
+                return Detail::multiply_block_avx2(a, b, c, rows, depth, columns);
+            case InstructionSet::sse2:
+                return Detail::multiply_block_sse2(a, b, c, rows, depth, columns);
+            case InstructionSet::scalar:
+                break;
+            }
+#endif
+            (void)is;
+            Detail::multiply_block<sizeof(T)>(a, b, c, rows, depth, columns);
+        }
+    } // namespace Simd
+
+    namespace Detail
+    {
+        // packed blocks are padded with zeros - micro kernel always works on whole tiles
+        inline constexpr size_t pad_items(size_t n, size_t multiple) noexcept
+        {
+            return (n + multiple - 1) / multiple * multiple;
+        }
+
+        template <typename T, typename Layout>
+        void pack_block(const MdView<const T, 2, Layout>& block, T* out, size_t padded_rows, size_t padded_columns)
+        {
+            for (size_t i = 0; i < padded_rows; ++i)
+            {
+                T* row = out + i * padded_columns;
+                const size_t columns = i < block.extent(0) ? block.extent(1) : 0;
+                for (size_t j = 0; j < columns; ++j)
+                    row[j] = block[i, j];
+                std::fill(row + columns, row + padded_columns, T{});
+            }
+        }
+
+        using MatrixExtents = std::array<size_t, 2>;
+
+        inline void check_product_extents(const MatrixExtents& a, const MatrixExtents& b, const MatrixExtents& c)
+        {
+            if (a[1] != b[0] || c[0] != a[0] || c[1] != b[1])
+                throw std::invalid_argument{"extents of matrices do not match"};
+        }
+    } // namespace Detail
+
+    // Matrix kernels - views may have any layout
+
+    // c = a * b - c must not overlap a or b
+    template <typename TA, typename LayoutA, typename TB, typename LayoutB, Arithmetic T, typename LayoutC>
+        requires std::same_as<std::remove_const_t<TA>, T> && std::same_as<std::remove_const_t<TB>, T>
+    void multiply(const MdView<TA, 2, LayoutA>& a, const MdView<TB, 2, LayoutB>& b, const MdView<T, 2, LayoutC>& c,
+                  Simd::InstructionSet is = Simd::instruction_set())
+    {
+        using namespace Simd::Detail;
+
+        Detail::check_product_extents(a.extents(), b.extents(), c.extents());
+
+        const size_t rows = a.extent(0), depth = a.extent(1), columns = b.extent(1);
+        const size_t column_multiple = 64 / sizeof(T); // 2 AVX batches
+
+        NumericVector<T> a_block(block_rows * block_depth);
+        NumericVector<T> b_block(block_depth * block_columns);
+        NumericVector<T> c_block(block_rows * block_columns);
+
+        if (depth == 0)
+        {
+            for (size_t i = 0; i < rows; ++i)
+                for (size_t j = 0; j < columns; ++j)
+                    c[i, j] = T{};
+            return;
+        }
+
+        for (size_t jc = 0; jc < columns; jc += block_columns)
+        {
+            const size_t nc = std::min(block_columns, columns - jc);
+            const size_t padded_nc = Detail::pad_items(nc, column_multiple);
+
+            for (size_t pc = 0; pc < depth; pc += block_depth)
+            {
+                const size_t kc = std::min(block_depth, depth - pc);
+                Detail::pack_block<T, Strided>(b.subview({pc, jc}, {kc, nc}), b_block.begin(), kc, padded_nc);
+
+                for (size_t ic = 0; ic < rows; ic += block_rows)
+                {
+                    const size_t mc = std::min(block_rows, rows - ic);
+                    const size_t padded_mc = Detail::pad_items(mc, tile_rows);
+                    Detail::pack_block<T, Strided>(a.subview({ic, pc}, {mc, kc}), a_block.begin(), padded_mc, kc);
+
+                    Simd::multiply_block(a_block.begin(), b_block.begin(), c_block.begin(), padded_mc, kc, padded_nc, is);
+
+                    // first block of depth initializes c - next ones are added
+                    const MdView<T, 2, Strided> c_tile = c.subview({ic, jc}, {mc, nc});
+                    for (size_t i = 0; i < mc; ++i)
+                    {
+                        const T* product = c_block.begin() + i * padded_nc;
+                        if (c_tile.stride(1) == 1)
+                        {
+                            T* row = &c_tile[i, 0];
+                            if (pc == 0)
+                                std::copy_n(product, nc, row);
+                            else
+                                Simd::add(row, product, row, nc, is);
+                        }
+                        else
+                        {
+                            for (size_t j = 0; j < nc; ++j)
+                                c_tile[i, j] = pc == 0 ? product[j] : c_tile[i, j] + product[j];
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    // out = transposed a - copied in tiles, so both reads & writes stay within a few cache lines
+    template <typename TA, typename LayoutA, typename T, typename LayoutOut>
+        requires std::same_as<std::remove_const_t<TA>, T>
+    void transpose(const MdView<TA, 2, LayoutA>& a, const MdView<T, 2, LayoutOut>& out)
+    {
+        constexpr size_t tile = 32;
+
+        if (a.extent(0) != out.extent(1) || a.extent(1) != out.extent(0))
+            throw std::invalid_argument{"extents of matrices do not match"};
+
+        for (size_t it = 0; it < a.extent(0); it += tile)
+            for (size_t jt = 0; jt < a.extent(1); jt += tile)
+            {
+                const size_t i_end = std::min(it + tile, a.extent(0)), j_end = std::min(jt + tile, a.extent(1));
+                for (size_t i = it; i < i_end; ++i)
+                    for (size_t j = jt; j < j_end; ++j)
+                        out[j, i] = a[i, j];
+            }
+    }
+
+    // Reductions - contiguous rows or columns are summed with SIMD kernels
+
+    // out[i] = sum of row i
+    template <typename TA, typename Layout, Arithmetic T>
+        requires std::same_as<std::remove_const_t<TA>, T>
+    void row_sums(const MdView<TA, 2, Layout>& a, std::span<T> out)
+    {
+        if (out.size() != a.extent(0))
+            throw std::invalid_argument{"size of output does not match rows of matrix"};
+
+        std::ranges::fill(out, T{});
+        if (a.stride(1) == 1) // row-major
+        {
+            for (size_t i = 0; i < a.extent(0); ++i)
+                out[i] = Simd::sum(&a[i, 0], a.extent(1));
+        }
+        else if (a.stride(0) == 1) // column-major - whole columns are added
+        {
+            for (size_t j = 0; j < a.extent(1); ++j)
+                Simd::add(out.data(), &a[0, j], out.data(), out.size());
+        }
+        else
+        {
+            for (size_t i = 0; i < a.extent(0); ++i)
+                for (size_t j = 0; j < a.extent(1); ++j)
+                    out[i] += a[i, j];
+        }
+    }
+
+    // out[j] = sum of column j
+    template <typename TA, typename Layout, Arithmetic T>
+        requires std::same_as<std::remove_const_t<TA>, T>
+    void column_sums(const MdView<TA, 2, Layout>& a, std::span<T> out)
+    {
+        row_sums(MdView<TA, 2, Strided>(a).transposed(), out);
+    }
+
+    template <typename TA, typename Layout>
+        requires Arithmetic<std::remove_const_t<TA>>
+    std::remove_const_t<TA> sum(const MdView<TA, 2, Layout>& a)
+    {
+        using T = std::remove_const_t<TA>;
+
+        if (a.stride(1) != 1 && a.stride(0) == 1)
+            return sum(MdView<TA, 2, Strided>(a).transposed());
+
+        NumericVector<T> sums(a.extent(0));
+        row_sums(a, std::span<T>(sums.begin(), sums.size()));
+        return ModernCpp::sum(sums);
+    }
+} // namespace ModernCpp
+
+#endif // MD_VIEW_HPP
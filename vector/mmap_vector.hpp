@@ -0,0 +1,276 @@
+#ifndef MMAP_VECTOR_HPP
+#define MMAP_VECTOR_HPP
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace ModernCpp
+{
+    // Vector of trivially copyable items stored in a memory-mapped file (POSIX only)
+    // - file contains raw items - its size must be a multiple of sizeof(T)
+    // - MmapVector<T> opens or creates file for reading & writing - it grows with ftruncate + remap
+    //   and the file is truncated to size() when the vector is destroyed
+    // - MmapVector<const T> opens existing file read-only - items are not copied, pages are loaded on first access
+    template <typename T>
+        requires std::is_trivially_copyable_v<T>
+    class MmapVector
+    {
+        static constexpr bool is_read_only = std::is_const_v<T>;
+
+    public:
+        using value_type = std::remove_const_t<T>;
+        using iterator = T*;
+        using const_iterator = const T*;
+
+        static constexpr size_t growth_factor = 2;
+
+        explicit MmapVector(const std::filesystem::path& path)
+        {
+            fd_ = ::open(path.c_str(), is_read_only ? O_RDONLY : O_RDWR | O_CREAT, 0644);
+            if (fd_ == -1)
+                throw_system_error("cannot open " + path.string());
+
+            try
+            {
+                struct stat file_stat{};
+                if (::fstat(fd_, &file_stat) == -1)
+                    throw_system_error("cannot read size of " + path.string());
+
+                const auto bytes = static_cast<size_t>(file_stat.st_size);
+                if (bytes % sizeof(T) != 0)
+                    throw std::runtime_error{"size of " + path.string() + " is not a multiple of item size"};
+
+                items_ = map(bytes / sizeof(T));
+                size_ = capacity_ = bytes / sizeof(T);
+            }
+            catch (...)
+            {
+                ::close(fd_);
+                throw;
+            }
+        }
+
+        MmapVector(const MmapVector&) = delete;
+        MmapVector& operator=(const MmapVector&) = delete;
+
+        // move constructor
+        MmapVector(MmapVector&& source) noexcept
+            : fd_{std::exchange(source.fd_, -1)}
+            , size_{std::exchange(source.size_, 0)}
+            , capacity_{std::exchange(source.capacity_, 0)}
+            , items_{std::exchange(source.items_, nullptr)}
+        {
+        }
+
+        // move assignment
+        MmapVector& operator=(MmapVector&& source) noexcept
+        {
+            if (this != &source) // avoiding self assignment
+            {
+                MmapVector temp(std::move(source));
+                swap(temp);
+            }
+
+            return *this;
+        }
+
+        ~MmapVector() noexcept
+        {
+            if (fd_ == -1)
+                return;
+
+            unmap(items_, capacity_);
+            if constexpr (!is_read_only)
+            {
+                // spare capacity is cut off - errors cannot be reported from destructor
+                [[maybe_unused]] const int result = ::ftruncate(fd_, static_cast<off_t>(size_ * sizeof(T)));
+            }
+            ::close(fd_);
+        }
+
+        void swap(MmapVector& that) noexcept
+        {
+            std::swap(this->fd_, that.fd_);
+            std::swap(this->size_, that.size_);
+            std::swap(this->capacity_, that.capacity_);
+            std::swap(this->items_, that.items_);
+        }
+
+        size_t size() const noexcept
+        {
+            return size_;
+        }
+
+        size_t capacity() const noexcept
+        {
+            return capacity_;
+        }
+
+        bool empty() const noexcept
+        {
+            return size_ == 0;
+        }
+
+        T* data() noexcept
+        {
+            return items_;
+        }
+
+        const T* data() const noexcept
+        {
+            return items_;
+        }
+
+        iterator begin() noexcept
+        {
+            return items_;
+        }
+
+        iterator end() noexcept
+        {
+            return items_ + size_;
+        }
+
+        const_iterator begin() const noexcept
+        {
+            return items_;
+        }
+
+        const_iterator end() const noexcept
+        {
+            return items_ + size_;
+        }
+
+        const_iterator cbegin() const noexcept
+        {
+            return items_;
+        }
+
+        const_iterator cend() const noexcept
+        {
+            return items_ + size_;
+        }
+
+        T& operator[](size_t index) noexcept
+        {
+            return items_[index];
+        }
+
+        const T& operator[](size_t index) const noexcept
+        {
+            return items_[index];
+        }
+
+        bool operator==(const MmapVector& that) const
+        {
+            return std::ranges::equal(*this, that);
+        }
+
+        // extends file and maps it again - existing items are not copied by the process
+        void reserve(size_t new_capacity)
+            requires(!is_read_only)
+        {
+            if (new_capacity <= capacity_)
+                return;
+
+            if (::ftruncate(fd_, static_cast<off_t>(new_capacity * sizeof(T))) == -1)
+                throw_system_error("cannot resize mapped file");
+
+            // new mapping is created before the old one is released - vector is unchanged if mapping fails
+            T* new_items = map(new_capacity);
+            unmap(items_, capacity_);
+            items_ = new_items;
+            capacity_ = new_capacity;
+        }
+
+        // new items are value-initialized
+        void resize(size_t new_size)
+            requires(!is_read_only)
+        {
+            reserve(new_size);
+            if (new_size > size_)
+                std::uninitialized_value_construct(items_ + size_, items_ + new_size);
+            size_ = new_size;
+        }
+
+        template <typename TItem>
+        void push_back(TItem&& item)
+            requires(!is_read_only)
+        {
+            emplace_back(std::forward<TItem>(item));
+        }
+
+        template <typename... TArgs>
+        T& emplace_back(TArgs&&... args)
+            requires(!is_read_only)
+        {
+            // item is created before remapping - args may refer to an item of this vector
+            const T item(std::forward<TArgs>(args)...);
+
+            if (size_ == capacity_)
+                reserve(next_capacity());
+
+            return *std::construct_at(items_ + size_++, item);
+        }
+
+        // flushes modified pages to file
+        void sync()
+            requires(!is_read_only)
+        {
+            if (items_ && ::msync(items_, size_ * sizeof(T), MS_SYNC) == -1)
+                throw_system_error("cannot sync mapped file");
+        }
+
+    private:
+        int fd_{-1};
+        size_t size_{};
+        size_t capacity_{};
+        T* items_{};
+
+        // geometric growth - the first mapping takes a whole page
+        size_t next_capacity() const noexcept
+        {
+            const size_t page_size = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+            return capacity_ == 0 ? std::max<size_t>(1, page_size / sizeof(T)) : capacity_ * growth_factor;
+        }
+
+        T* map(size_t capacity) const
+        {
+            if (capacity == 0) // empty mappings are not allowed
+                return nullptr;
+
+            const int protection = is_read_only ? PROT_READ : PROT_READ | PROT_WRITE;
+            void* address = ::mmap(nullptr, capacity * sizeof(T), protection, MAP_SHARED, fd_, 0);
+            if (address == MAP_FAILED)
+                throw_system_error("cannot map file");
+
+            return static_cast<T*>(address);
+        }
+
+        static void unmap(T* items, size_t capacity) noexcept
+        {
+            if (items)
+                ::munmap(const_cast<value_type*>(items), capacity * sizeof(T));
+        }
+
+        [[noreturn]] static void throw_system_error(const std::string& what)
+        {
+            throw std::system_error{errno, std::generic_category(), what};
+        }
+    };
+} // namespace ModernCpp
+
+#endif // MMAP_VECTOR_HPP
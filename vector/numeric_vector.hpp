@@ -0,0 +1,742 @@
+#ifndef NUMERIC_VECTOR_HPP
+#define NUMERIC_VECTOR_HPP
+
+#include "vector.hpp"
+
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define MODERNCPP_SIMD_X86 1
+#endif
+
+namespace ModernCpp
+{
+    template <typename T, size_t Align>
+    class AlignedAllocator
+    {
+        static_assert(Align >= alignof(T) && (Align & (Align - 1)) == 0, "alignment must be a power of two");
+
+    public:
+        using value_type = T;
+
+        static constexpr size_t alignment = Align;
+
+        template <typename U>
+        struct rebind
+        {
+            using other = AlignedAllocator<U, Align>;
+        };
+
+        AlignedAllocator() noexcept = default;
+
+        template <typename U>
+        AlignedAllocator(const AlignedAllocator<U, Align>&) noexcept
+        {
+        }
+
+        T* allocate(size_t n)
+        {
+            return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t{Align}));
+        }
+
+        void deallocate(T* ptr, size_t n) noexcept
+        {
+            ::operator delete(ptr, n * sizeof(T), std::align_val_t{Align});
+        }
+
+        template <typename U>
+        bool operator==(const AlignedAllocator<U, Align>&) const noexcept
+        {
+            return true;
+        }
+    };
+
+    template <typename T>
+    concept Arithmetic = (std::integral<T> && !std::same_as<T, bool>) || std::floating_point<T>;
+
+    // numeric buffer - storage is aligned to Align bytes (cache line by default)
+    template <Arithmetic T, size_t Align = 64>
+    using NumericVector = Vector<T, AlignedAllocator<T, Align>>;
+
+    namespace Simd
+    {
+        enum class InstructionSet
+        {
+            scalar,
+            sse2,
+            avx2
+        };
+
+        // the best instruction set supported by current CPU - detected once
+        inline InstructionSet instruction_set() noexcept
+        {
+#ifdef MODERNCPP_SIMD_X86
+            static const InstructionSet detected = [] {
+                __builtin_cpu_init();
+                if (__builtin_cpu_supports("avx2"))
+                    return InstructionSet::avx2;
+                if (__builtin_cpu_supports("sse2"))
+                    return InstructionSet::sse2;
+                return InstructionSet::scalar;
+            }();
+            return detected;
+#else
+            return InstructionSet::scalar;
+#endif
+        }
+
+        enum class Comparison
+        {
+            equal,
+            not_equal,
+            less,
+            less_equal,
+            greater,
+            greater_equal
+        };
+
+        // predicate comparing items with a value - erase_if & filter_into of Vector use SIMD kernels for it
+        template <Arithmetic T>
+        struct Compare
+        {
+            Comparison comparison;
+            T value;
+
+            constexpr bool operator()(T item) const noexcept
+            {
+                switch (comparison)
+                {
+                case Comparison::equal:
+                    return item == value;
+                case Comparison::not_equal:
+                    return item != value;
+                case Comparison::less:
+                    return item < value;
+                case Comparison::less_equal:
+                    return item <= value;
+                case Comparison::greater:
+                    return item > value;
+                case Comparison::greater_equal:
+                    return item >= value;
+                }
+                return false;
+            }
+        };
+
+        // vec.erase_if(Simd::less(0)) removes negative items
+        template <Arithmetic T>
+        constexpr Compare<T> equal_to(T value) noexcept
+        {
+            return {Comparison::equal, value};
+        }
+
+        template <Arithmetic T>
+        constexpr Compare<T> not_equal_to(T value) noexcept
+        {
+            return {Comparison::not_equal, value};
+        }
+
+        template <Arithmetic T>
+        constexpr Compare<T> less(T value) noexcept
+        {
+            return {Comparison::less, value};
+        }
+
+        template <Arithmetic T>
+        constexpr Compare<T> less_equal(T value) noexcept
+        {
+            return {Comparison::less_equal, value};
+        }
+
+        template <Arithmetic T>
+        constexpr Compare<T> greater(T value) noexcept
+        {
+            return {Comparison::greater, value};
+        }
+
+        template <Arithmetic T>
+        constexpr Compare<T> greater_equal(T value) noexcept
+        {
+            return {Comparison::greater_equal, value};
+        }
+
+        namespace Detail
+        {
+            enum class Op
+            {
+                add,
+                subtract,
+                multiply
+            };
+
+            // batches are passed by reference - passing AVX vectors by value would depend on ABI of a caller
+
+            template <Op op, typename V>
+            [[gnu::always_inline]] inline void apply(V& a, const V& b)
+            {
+                if constexpr (op == Op::add)
+                    a += b;
+                else if constexpr (op == Op::subtract)
+                    a -= b;
+                else
+                    a *= b;
+            }
+
+            // Bytes wide batch of T - one item for scalar code
+            template <typename T, size_t Bytes, bool IsScalar = (Bytes == sizeof(T))>
+            struct Batch;
+
+            template <typename T, size_t Bytes>
+            struct Batch<T, Bytes, true>
+            {
+                using type = T;
+                static constexpr size_t size = 1;
+
+                [[gnu::always_inline]] static void load(type& v, const T* src)
+                {
+                    v = *src;
+                }
+
+                [[gnu::always_inline]] static void store(T* dest, const type& v)
+                {
+                    *dest = v;
+                }
+
+                [[gnu::always_inline]] static void broadcast(type& v, T value)
+                {
+                    v = value;
+                }
+
+                [[gnu::always_inline]] static T reduce(const type& v)
+                {
+                    return v;
+                }
+            };
+
+#ifdef MODERNCPP_SIMD_X86
+            // batch built with compiler vector extensions - the instructions are chosen
+            // by the target of the function into which the kernel is inlined
+            template <typename T, size_t Bytes>
+            struct Batch<T, Bytes, false>
+            {
+                typedef T type __attribute__((vector_size(Bytes)));
+                static constexpr size_t size = Bytes / sizeof(T);
+
+                [[gnu::always_inline]] static void load(type& v, const T* src)
+                {
+                    std::memcpy(&v, src, sizeof(v));
+                }
+
+                [[gnu::always_inline]] static void store(T* dest, const type& v)
+                {
+                    std::memcpy(dest, &v, sizeof(v));
+                }
+
+                [[gnu::always_inline]] static void broadcast(type& v, T value)
+                {
+                    v = type{} + value;
+                }
+
+                [[gnu::always_inline]] static T reduce(const type& v)
+                {
+                    T result{};
+                    for (size_t i = 0; i < size; ++i)
+                        result += v[i];
+                    return result;
+                }
+            };
+#endif
+
+            template <size_t Bytes, Op op, typename T>
+            [[gnu::always_inline]] inline void transform(const T* a, const T* b, T* out, size_t n)
+            {
+                using B = Batch<T, Bytes>;
+
+                typename B::type x, y;
+                size_t i = 0;
+                for (; i + B::size <= n; i += B::size)
+                {
+                    B::load(x, a + i);
+                    B::load(y, b + i);
+                    apply<op>(x, y);
+                    B::store(out + i, x);
+                }
+                for (; i < n; ++i)
+                {
+                    T item = a[i];
+                    apply<op>(item, b[i]);
+                    out[i] = item;
+                }
+            }
+
+            template <size_t Bytes, typename T>
+            [[gnu::always_inline]] inline void scale(const T* a, T factor, T* out, size_t n)
+            {
+                using B = Batch<T, Bytes>;
+
+                typename B::type factors, x;
+                B::broadcast(factors, factor);
+                size_t i = 0;
+                for (; i + B::size <= n; i += B::size)
+                {
+                    B::load(x, a + i);
+                    x *= factors;
+                    B::store(out + i, x);
+                }
+                for (; i < n; ++i)
+                    out[i] = a[i] * factor;
+            }
+
+            template <size_t Bytes, typename T>
+            [[gnu::always_inline]] inline void offset(const T* a, T value, T* out, size_t n)
+            {
+                using B = Batch<T, Bytes>;
+
+                typename B::type values, x;
+                B::broadcast(values, value);
+                size_t i = 0;
+                for (; i + B::size <= n; i += B::size)
+                {
+                    B::load(x, a + i);
+                    x += values;
+                    B::store(out + i, x);
+                }
+                for (; i < n; ++i)
+                    out[i] = a[i] + value;
+            }
+
+            template <size_t Bytes, typename T>
+            [[gnu::always_inline]] inline void fill(T* out, T value, size_t n)
+            {
+                using B = Batch<T, Bytes>;
+
+                typename B::type values;
+                B::broadcast(values, value);
+                size_t i = 0;
+                for (; i + B::size <= n; i += B::size)
+                    B::store(out + i, values);
+                for (; i < n; ++i)
+                    out[i] = value;
+            }
+
+            // four independent accumulators hide latency of add instructions
+            template <size_t Bytes, typename T>
+            [[gnu::always_inline]] inline T dot(const T* a, const T* b, size_t n)
+            {
+                using B = Batch<T, Bytes>;
+
+                typename B::type acc_0, acc_1, acc_2, acc_3, x, y;
+                B::broadcast(acc_0, T{});
+                acc_1 = acc_2 = acc_3 = acc_0;
+
+                size_t i = 0;
+                for (; i + 4 * B::size <= n; i += 4 * B::size)
+                {
+                    B::load(x, a + i);
+                    B::load(y, b + i);
+                    acc_0 += x * y;
+                    B::load(x, a + i + B::size);
+                    B::load(y, b + i + B::size);
+                    acc_1 += x * y;
+                    B::load(x, a + i + 2 * B::size);
+                    B::load(y, b + i + 2 * B::size);
+                    acc_2 += x * y;
+                    B::load(x, a + i + 3 * B::size);
+                    B::load(y, b + i + 3 * B::size);
+                    acc_3 += x * y;
+                }
+                for (; i + B::size <= n; i += B::size)
+                {
+                    B::load(x, a + i);
+                    B::load(y, b + i);
+                    acc_0 += x * y;
+                }
+
+                acc_0 += acc_1;
+                acc_2 += acc_3;
+                acc_0 += acc_2;
+                T result = B::reduce(acc_0);
+                for (; i < n; ++i)
+                    result += a[i] * b[i];
+                return result;
+            }
+
+            template <size_t Bytes, typename T>
+            [[gnu::always_inline]] inline T sum(const T* a, size_t n)
+            {
+                using B = Batch<T, Bytes>;
+
+                typename B::type acc_0, acc_1, acc_2, acc_3, x;
+                B::broadcast(acc_0, T{});
+                acc_1 = acc_2 = acc_3 = acc_0;
+
+                size_t i = 0;
+                for (; i + 4 * B::size <= n; i += 4 * B::size)
+                {
+                    B::load(x, a + i);
+                    acc_0 += x;
+                    B::load(x, a + i + B::size);
+                    acc_1 += x;
+                    B::load(x, a + i + 2 * B::size);
+                    acc_2 += x;
+                    B::load(x, a + i + 3 * B::size);
+                    acc_3 += x;
+                }
+                for (; i + B::size <= n; i += B::size)
+                {
+                    B::load(x, a + i);
+                    acc_0 += x;
+                }
+
+                acc_0 += acc_1;
+                acc_2 += acc_3;
+                acc_0 += acc_2;
+                T result = B::reduce(acc_0);
+                for (; i < n; ++i)
+                    result += a[i];
+                return result;
+            }
+
+#ifdef MODERNCPP_SIMD_X86
+            template <Comparison comparison, typename M, typename V>
+            [[gnu::always_inline]] inline void compare(M& selected, const V& x, const V& y)
+            {
+                if constexpr (comparison == Comparison::equal)
+                    selected = x == y;
+                else if constexpr (comparison == Comparison::not_equal)
+                    selected = x != y;
+                else if constexpr (comparison == Comparison::less)
+                    selected = x < y;
+                else if constexpr (comparison == Comparison::less_equal)
+                    selected = x <= y;
+                else if constexpr (comparison == Comparison::greater)
+                    selected = x > y;
+                else
+                    selected = x >= y;
+            }
+
+            // indexes of set bits of a mask followed by zeros - shuffle moving selected lanes to the left
+            template <size_t Lanes, typename Index>
+            struct LeftPackTable
+            {
+                Index indexes[1u << Lanes][Lanes]{};
+
+                constexpr LeftPackTable()
+                {
+                    for (unsigned mask = 0; mask < (1u << Lanes); ++mask)
+                        for (size_t lane = 0, packed = 0; lane < Lanes; ++lane)
+                            if (mask & (1u << lane))
+                                indexes[mask][packed++] = static_cast<Index>(lane);
+                }
+            };
+
+            template <size_t Lanes, typename Index>
+            inline constexpr LeftPackTable<Lanes, Index> left_pack_table{};
+
+            // stream compaction: selected lanes of each batch are shuffled to the left and the whole batch is stored,
+            // output advances by number of selected lanes (dest may be equal to first)
+            template <size_t Bytes, Comparison comparison, typename T>
+            [[gnu::always_inline]] inline T* compact(const T* first, size_t n, T* dest, T value, bool keep)
+            {
+                static_assert(sizeof(T) == 4 || sizeof(T) == 8, "shuffle table is built for 32 & 64 bit items");
+
+                using B = Batch<T, Bytes>;
+                using Index = std::conditional_t<sizeof(T) == 4, int32_t, int64_t>;
+                typedef Index Indexes __attribute__((vector_size(Bytes)));
+
+                const unsigned flip = keep ? 0 : (1u << B::size) - 1;
+
+                typename B::type values, x;
+                B::broadcast(values, value);
+                Indexes selected, indexes; // comparison yields lanes of all ones or zeros
+
+                size_t i = 0;
+                for (; i + B::size <= n; i += B::size)
+                {
+                    B::load(x, first + i);
+                    compare<comparison>(selected, x, values);
+
+                    unsigned mask = 0;
+                    for (size_t lane = 0; lane < B::size; ++lane)
+                        mask |= static_cast<unsigned>(selected[lane] & 1) << lane;
+                    mask ^= flip;
+
+                    std::memcpy(&indexes, left_pack_table<B::size, Index>.indexes[mask], sizeof(indexes));
+                    x = __builtin_shuffle(x, indexes);
+                    B::store(dest, x);
+                    dest += std::popcount(mask);
+                }
+
+                const Compare<T> pred{comparison, value};
+                return ModernCpp::Detail::compact_items(first + i, first + n, dest, pred, keep);
+            }
+
+            // variable shuffles need AVX2 - SSE2 code uses the scalar kernel
+            template <Comparison comparison, typename T>
+            [[gnu::target("avx2")]] T* compact_avx2(const T* first, size_t n, T* dest, T value, bool keep)
+            {
+                return compact<32, comparison>(first, n, dest, value, keep);
+            }
+
+#define MODERNCPP_SIMD_KERNELS(suffix, target_name, bytes)                                                     \
+    template <Op op, typename T>                                                                               \
+    [[gnu::target(target_name)]] void transform_##suffix(const T* a, const T* b, T* out, size_t n)             \
+    {                                                                                                          \
+        transform<bytes, op>(a, b, out, n);                                                                    \
+    }                                                                                                          \
+    template <typename T>                                                                                      \
+    [[gnu::target(target_name)]] void scale_##suffix(const T* a, T factor, T* out, size_t n)                   \
+    {                                                                                                          \
+        scale<bytes>(a, factor, out, n);                                                                       \
+    }                                                                                                          \
+    template <typename T>                                                                                      \
+    [[gnu::target(target_name)]] void offset_##suffix(const T* a, T value, T* out, size_t n)                   \
+    {                                                                                                          \
+        offset<bytes>(a, value, out, n);                                                                       \
+    }                                                                                                          \
+    template <typename T>                                                                                      \
+    [[gnu::target(target_name)]] void fill_##suffix(T* out, T value, size_t n)                                 \
+    {                                                                                                          \
+        fill<bytes>(out, value, n);                                                                            \
+    }                                                                                                          \
+    template <typename T>                                                                                      \
+    [[gnu::target(target_name)]] T dot_##suffix(const T* a, const T* b, size_t n)                              \
+    {                                                                                                          \
+        return dot<bytes>(a, b, n);                                                                            \
+    }                                                                                                          \
+    template <typename T>                                                                                      \
+    [[gnu::target(target_name)]] T sum_##suffix(const T* a, size_t n)                                          \
+    {                                                                                                          \
+        return sum<bytes>(a, n);                                                                               \
+    }
+
+            MODERNCPP_SIMD_KERNELS(sse2, "sse2", 16)
+            MODERNCPP_SIMD_KERNELS(avx2, "avx2", 32)
+
+#undef MODERNCPP_SIMD_KERNELS
+
+#define MODERNCPP_SIMD_DISPATCH(instruction_set, kernel, ...)   \
+    switch (instruction_set)                                    \
+    {                                                           \
+    case InstructionSet::avx2:                                  \
+        return Detail::kernel##_avx2 __VA_ARGS__;               \
+    case InstructionSet::sse2:                                  \
+        return Detail::kernel##_sse2 __VA_ARGS__;               \
+    case InstructionSet::scalar:                                \
+        break;                                                  \
+    }
+#else
+#define MODERNCPP_SIMD_DISPATCH(instruction_set, kernel, ...) (void)instruction_set;
+#endif
+        } // namespace Detail
+
+        // Kernels working on raw buffers of n items. Instruction set is selected at runtime;
+        // passing a lower one than detected is allowed (e.g. to compare results with scalar code).
+
+        template <Arithmetic T>
+        void add(const T* a, const T* b, T* out, size_t n, InstructionSet is = instruction_set())
+        {
+            MODERNCPP_SIMD_DISPATCH(is, transform, <Detail::Op::add>(a, b, out, n))
+            Detail::transform<sizeof(T), Detail::Op::add>(a, b, out, n);
+        }
+
+        template <Arithmetic T>
+        void subtract(const T* a, const T* b, T* out, size_t n, InstructionSet is = instruction_set())
+        {
+            MODERNCPP_SIMD_DISPATCH(is, transform, <Detail::Op::subtract>(a, b, out, n))
+            Detail::transform<sizeof(T), Detail::Op::subtract>(a, b, out, n);
+        }
+
+        template <Arithmetic T>
+        void multiply(const T* a, const T* b, T* out, size_t n, InstructionSet is = instruction_set())
+        {
+            MODERNCPP_SIMD_DISPATCH(is, transform, <Detail::Op::multiply>(a, b, out, n))
+            Detail::transform<sizeof(T), Detail::Op::multiply>(a, b, out, n);
+        }
+
+        template <Arithmetic T>
+        void scale(const T* a, T factor, T* out, size_t n, InstructionSet is = instruction_set())
+        {
+            MODERNCPP_SIMD_DISPATCH(is, scale, (a, factor, out, n))
+            Detail::scale<sizeof(T)>(a, factor, out, n);
+        }
+
+        // out[i] = a[i] + value
+        template <Arithmetic T>
+        void offset(const T* a, T value, T* out, size_t n, InstructionSet is = instruction_set())
+        {
+            MODERNCPP_SIMD_DISPATCH(is, offset, (a, value, out, n))
+            Detail::offset<sizeof(T)>(a, value, out, n);
+        }
+
+        template <Arithmetic T>
+        void fill(T* out, T value, size_t n, InstructionSet is = instruction_set())
+        {
+            MODERNCPP_SIMD_DISPATCH(is, fill, (out, value, n))
+            Detail::fill<sizeof(T)>(out, value, n);
+        }
+
+        template <Arithmetic T>
+        T dot(const T* a, const T* b, size_t n, InstructionSet is = instruction_set())
+        {
+            MODERNCPP_SIMD_DISPATCH(is, dot, (a, b, n))
+            return Detail::dot<sizeof(T)>(a, b, n);
+        }
+
+        template <Arithmetic T>
+        T sum(const T* a, size_t n, InstructionSet is = instruction_set())
+        {
+            MODERNCPP_SIMD_DISPATCH(is, sum, (a, n))
+            return Detail::sum<sizeof(T)>(a, n);
+        }
+
+        // copies items for which pred(item) == keep to dest (dest may be equal to first) - returns end of output;
+        // dest must have room for n items
+        template <Arithmetic T>
+        T* compact(const T* first, size_t n, T* dest, const Compare<T>& pred, bool keep, InstructionSet is = instruction_set())
+        {
+#ifdef MODERNCPP_SIMD_X86
+            if constexpr (sizeof(T) == 4 || sizeof(T) == 8)
+            {
+                if (is == InstructionSet::avx2)
+                {
+                    switch (pred.comparison)
+                    {
+                    case Comparison::equal:
+                        return Detail::compact_avx2<Comparison::equal>(first, n, dest, pred.value, keep);
+                    case Comparison::not_equal:
+                        return Detail::compact_avx2<Comparison::not_equal>(first, n, dest, pred.value, keep);
+                    case Comparison::less:
+                        return Detail::compact_avx2<Comparison::less>(first, n, dest, pred.value, keep);
+                    case Comparison::less_equal:
+                        return Detail::compact_avx2<Comparison::less_equal>(first, n, dest, pred.value, keep);
+                    case Comparison::greater:
+                        return Detail::compact_avx2<Comparison::greater>(first, n, dest, pred.value, keep);
+                    case Comparison::greater_equal:
+                        return Detail::compact_avx2<Comparison::greater_equal>(first, n, dest, pred.value, keep);
+                    }
+                }
+            }
+#endif
+            (void)is;
+            return ModernCpp::Detail::compact_items(first, first + n, dest, pred, keep);
+        }
+
+        // found by ADL from Vector::erase_if & Vector::filter_into
+        template <Arithmetic T>
+        T* compact_items(const T* first, const T* last, T* dest, const Compare<T>& pred, bool keep)
+        {
+            return compact(first, static_cast<size_t>(last - first), dest, pred, keep);
+        }
+
+#undef MODERNCPP_SIMD_DISPATCH
+    } // namespace Simd
+
+    namespace Detail
+    {
+        template <typename T, size_t Align, typename Tracing>
+        void check_sizes(const Vector<T, AlignedAllocator<T, Align>, Tracing>& a, const Vector<T, AlignedAllocator<T, Align>, Tracing>& b)
+        {
+            if (a.size() != b.size())
+                throw std::invalid_argument{"Vector sizes do not match"};
+        }
+    } // namespace Detail
+
+    // element-wise arithmetic for numeric vectors
+
+    template <Arithmetic T, size_t Align, typename Tracing>
+    Vector<T, AlignedAllocator<T, Align>, Tracing>& operator+=(Vector<T, AlignedAllocator<T, Align>, Tracing>& a, const Vector<T, AlignedAllocator<T, Align>, Tracing>& b)
+    {
+        Detail::check_sizes(a, b);
+        Simd::add(a.begin(), b.begin(), a.begin(), a.size());
+        return a;
+    }
+
+    template <Arithmetic T, size_t Align, typename Tracing>
+    Vector<T, AlignedAllocator<T, Align>, Tracing>& operator-=(Vector<T, AlignedAllocator<T, Align>, Tracing>& a, const Vector<T, AlignedAllocator<T, Align>, Tracing>& b)
+    {
+        Detail::check_sizes(a, b);
+        Simd::subtract(a.begin(), b.begin(), a.begin(), a.size());
+        return a;
+    }
+
+    template <Arithmetic T, size_t Align, typename Tracing>
+    Vector<T, AlignedAllocator<T, Align>, Tracing>& operator*=(Vector<T, AlignedAllocator<T, Align>, Tracing>& a, const Vector<T, AlignedAllocator<T, Align>, Tracing>& b)
+    {
+        Detail::check_sizes(a, b);
+        Simd::multiply(a.begin(), b.begin(), a.begin(), a.size());
+        return a;
+    }
+
+    template <Arithmetic T, size_t Align, typename Tracing>
+    Vector<T, AlignedAllocator<T, Align>, Tracing>& operator*=(Vector<T, AlignedAllocator<T, Align>, Tracing>& a, std::type_identity_t<T> factor)
+    {
+        Simd::scale(a.begin(), factor, a.begin(), a.size());
+        return a;
+    }
+
+    // binary operators take a by value and return it by name - result is moved, never copied
+    // (return a += b; would copy-construct result from the returned reference)
+    template <Arithmetic T, size_t Align, typename Tracing>
+    Vector<T, AlignedAllocator<T, Align>, Tracing> operator+(Vector<T, AlignedAllocator<T, Align>, Tracing> a, const Vector<T, AlignedAllocator<T, Align>, Tracing>& b)
+    {
+        a += b;
+        return a;
+    }
+
+    template <Arithmetic T, size_t Align, typename Tracing>
+    Vector<T, AlignedAllocator<T, Align>, Tracing> operator-(Vector<T, AlignedAllocator<T, Align>, Tracing> a, const Vector<T, AlignedAllocator<T, Align>, Tracing>& b)
+    {
+        a -= b;
+        return a;
+    }
+
+    template <Arithmetic T, size_t Align, typename Tracing>
+    Vector<T, AlignedAllocator<T, Align>, Tracing> operator*(Vector<T, AlignedAllocator<T, Align>, Tracing> a, const Vector<T, AlignedAllocator<T, Align>, Tracing>& b)
+    {
+        a *= b;
+        return a;
+    }
+
+    template <Arithmetic T, size_t Align, typename Tracing>
+    Vector<T, AlignedAllocator<T, Align>, Tracing> operator*(Vector<T, AlignedAllocator<T, Align>, Tracing> a, std::type_identity_t<T> factor)
+    {
+        a *= factor;
+        return a;
+    }
+
+    template <Arithmetic T, size_t Align, typename Tracing>
+    Vector<T, AlignedAllocator<T, Align>, Tracing> operator*(std::type_identity_t<T> factor, Vector<T, AlignedAllocator<T, Align>, Tracing> a)
+    {
+        a *= factor;
+        return a;
+    }
+
+    template <Arithmetic T, size_t Align, typename Tracing>
+    T dot(const Vector<T, AlignedAllocator<T, Align>, Tracing>& a, const Vector<T, AlignedAllocator<T, Align>, Tracing>& b)
+    {
+        Detail::check_sizes(a, b);
+        return Simd::dot(a.begin(), b.begin(), a.size());
+    }
+
+    template <Arithmetic T, size_t Align, typename Tracing>
+    T sum(const Vector<T, AlignedAllocator<T, Align>, Tracing>& a)
+    {
+        return Simd::sum(a.begin(), a.size());
+    }
+
+    template <Arithmetic T, size_t Align, typename Tracing>
+    void fill(Vector<T, AlignedAllocator<T, Align>, Tracing>& a, std::type_identity_t<T> value)
+    {
+        Simd::fill(a.begin(), value, a.size());
+    }
+} // namespace ModernCpp
+
+#endif // NUMERIC_VECTOR_HPP
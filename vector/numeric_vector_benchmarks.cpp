@@ -0,0 +1,247 @@
+#include "md_view.hpp"
+#include "numeric_vector.hpp"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+
+namespace
+{
+    using ModernCpp::Simd::InstructionSet;
+
+    std::string to_string(InstructionSet is)
+    {
+        switch (is)
+        {
+        case InstructionSet::avx2:
+            return "avx2";
+        case InstructionSet::sse2:
+            return "sse2";
+        default:
+            return "scalar";
+        }
+    }
+
+    // runs kernel repeatedly for at least 200ms - returns calls per second
+    template <typename Kernel>
+    double measure_call_rate(Kernel kernel)
+    {
+        using namespace std::chrono;
+
+        size_t calls = 0;
+        const auto start = steady_clock::now();
+        auto elapsed = steady_clock::duration{};
+        do
+        {
+            kernel();
+            ++calls;
+            elapsed = steady_clock::now() - start;
+        } while (elapsed < 200ms);
+
+        return static_cast<double>(calls) / duration<double>(elapsed).count();
+    }
+
+    // prints achieved memory throughput
+    template <typename Kernel>
+    void report_throughput(const std::string& name, size_t bytes_per_call, Kernel kernel)
+    {
+        std::cout << std::left << std::setw(48) << name << std::fixed << std::setprecision(2)
+                  << (static_cast<double>(bytes_per_call) * measure_call_rate(kernel) / 1e9) << " GB/s\n";
+    }
+
+    // prints achieved arithmetic throughput
+    template <typename Kernel>
+    void report_gflops(const std::string& name, size_t flops_per_call, Kernel kernel)
+    {
+        std::cout << std::left << std::setw(48) << name << std::fixed << std::setprecision(2)
+                  << (static_cast<double>(flops_per_call) * measure_call_rate(kernel) / 1e9) << " GFLOP/s\n";
+    }
+} // namespace
+
+TEMPLATE_TEST_CASE("NumericVector - throughput", "[NumericVector][simd]", float, double, int)
+{
+    using namespace ModernCpp;
+
+    for (const size_t n : {4'096uz, 1'048'576uz, 16'777'216uz})
+    {
+        NumericVector<TestType> a(n), b(n), out(n);
+        fill(a, TestType{1});
+        fill(b, TestType{2});
+
+        for (const auto is : {InstructionSet::scalar, InstructionSet::sse2, InstructionSet::avx2})
+        {
+            if (is > Simd::instruction_set())
+                continue;
+
+            const std::string suffix = " - " + to_string(is) + " - " + std::to_string(n) + " items";
+
+            report_throughput("add" + suffix, 3 * n * sizeof(TestType), [&] {
+                Simd::add(a.begin(), b.begin(), out.begin(), n, is);
+            });
+
+            report_throughput("scale" + suffix, 2 * n * sizeof(TestType), [&] {
+                Simd::scale(a.begin(), TestType{3}, out.begin(), n, is);
+            });
+
+            volatile TestType sink{};
+            report_throughput("dot" + suffix, 2 * n * sizeof(TestType), [&] {
+                sink = Simd::dot(a.begin(), b.begin(), n, is);
+            });
+
+            report_throughput("sum" + suffix, n * sizeof(TestType), [&] {
+                sink = Simd::sum(a.begin(), n, is);
+            });
+
+            report_throughput("fill" + suffix, n * sizeof(TestType), [&] {
+                Simd::fill(out.begin(), TestType{7}, n, is);
+            });
+        }
+    }
+}
+
+TEST_CASE("NumericVector - operators vs scalar loops", "[NumericVector][simd]")
+{
+    using namespace ModernCpp;
+
+    constexpr size_t n = 1'048'576;
+
+    NumericVector<float> a(n), b(n);
+    fill(a, 1.0f);
+    fill(b, 2.0f);
+
+    Vector<float> plain_a(n), plain_b(n);
+
+    BENCHMARK("NumericVector<float> - a += b")
+    {
+        a += b;
+        return a[0];
+    };
+
+    BENCHMARK("Vector<float> - scalar loop a += b")
+    {
+        for (size_t i = 0; i < n; ++i)
+            plain_a[i] += plain_b[i];
+        return plain_a[0];
+    };
+
+    BENCHMARK("NumericVector<float> - dot")
+    {
+        return dot(a, b);
+    };
+
+    BENCHMARK("Vector<float> - scalar loop dot")
+    {
+        float result = 0.0f;
+        for (size_t i = 0; i < n; ++i)
+            result += plain_a[i] * plain_b[i];
+        return result;
+    };
+}
+
+TEST_CASE("NumericVector - stream compaction", "[NumericVector][simd][erase_if]")
+{
+    using namespace ModernCpp;
+
+    constexpr size_t n = 1'048'576;
+
+    // uniformly distributed values 0..99 - predicate x < selectivity keeps selectivity % of items
+    NumericVector<int> source;
+    source.reserve(n);
+    std::mt19937 rnd{42};
+    std::uniform_int_distribution<int> distribution{0, 99};
+    for (size_t i = 0; i < n; ++i)
+        source.push_back(distribution(rnd));
+
+    NumericVector<int> out;
+    out.reserve(n);
+
+    for (const int selectivity : {1, 10, 50, 90, 99})
+    {
+        const std::string suffix = " - " + std::to_string(selectivity) + "% selected";
+
+        BENCHMARK("filter_into - Simd::less" + suffix)
+        {
+            out.clear();
+            source.filter_into(out, Simd::less(selectivity));
+            return out.size();
+        };
+
+        BENCHMARK("filter_into - lambda (branch free scalar)" + suffix)
+        {
+            out.clear();
+            source.filter_into(out, [=](int x) { return x < selectivity; });
+            return out.size();
+        };
+
+        BENCHMARK("push_back if selected (branches)" + suffix)
+        {
+            out.clear();
+            for (const int x : source)
+                if (x < selectivity)
+                    out.push_back(x);
+            return out.size();
+        };
+
+        BENCHMARK_ADVANCED("erase_if - Simd::greater_equal" + suffix)(Catch::Benchmark::Chronometer meter)
+        {
+            std::vector<NumericVector<int>> copies(meter.runs(), source);
+            meter.measure([&](int run) { return copies[run].erase_if(Simd::greater_equal(selectivity)); });
+        };
+    }
+}
+
+TEMPLATE_TEST_CASE("MdView - matrix multiply", "[MdView][simd]", float, double)
+{
+    using namespace ModernCpp;
+
+    for (const size_t n : {256uz, 512uz, 1'024uz, 2'048uz, 4'096uz})
+    {
+        NumericVector<TestType> a(n * n), b(n * n), c(n * n);
+        fill(a, TestType{1});
+        fill(b, TestType{2});
+
+        const auto a_view = md_view(std::as_const(a), n, n);
+        const auto b_view = md_view(std::as_const(b), n, n);
+        const auto c_view = md_view(c, n, n);
+
+        const size_t flops = 2 * n * n * n;
+        const std::string suffix = " - " + std::to_string(n) + "x" + std::to_string(n);
+
+        for (const auto is : {InstructionSet::scalar, InstructionSet::sse2, InstructionSet::avx2})
+        {
+            if (is > Simd::instruction_set())
+                continue;
+
+            report_gflops("blocked multiply - " + to_string(is) + suffix, flops, [&] {
+                multiply(a_view, b_view, c_view, is);
+            });
+        }
+
+        // i-k-j loop order - the best one without blocking; takes minutes for bigger matrices
+        if (n <= 1'024)
+        {
+            report_gflops("naive multiply" + suffix, flops, [&] {
+                fill(c, TestType{});
+                for (size_t i = 0; i < n; ++i)
+                    for (size_t k = 0; k < n; ++k)
+                        for (size_t j = 0; j < n; ++j)
+                            c_view[i, j] += a_view[i, k] * b_view[k, j];
+            });
+        }
+
+        report_throughput("transpose" + suffix, 2 * n * n * sizeof(TestType), [&] {
+            transpose(a_view, c_view);
+        });
+
+        volatile TestType sink{};
+        report_throughput("column_sums" + suffix, n * n * sizeof(TestType), [&] {
+            column_sums(a_view, std::span<TestType>(b.begin(), n));
+            sink = b[0];
+        });
+    }
+}
@@ -0,0 +1,479 @@
+#include "md_view.hpp"
+#include "numeric_vector.hpp"
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+namespace
+{
+    using ModernCpp::Simd::InstructionSet;
+
+    // instruction sets supported by current CPU
+    std::vector<InstructionSet> available_instruction_sets()
+    {
+        std::vector<InstructionSet> result;
+        for (auto is : {InstructionSet::scalar, InstructionSet::sse2, InstructionSet::avx2})
+            if (is <= ModernCpp::Simd::instruction_set())
+                result.push_back(is);
+        return result;
+    }
+
+    template <typename T>
+    ModernCpp::NumericVector<T> make_sequence(size_t n, int start = 1)
+    {
+        ModernCpp::NumericVector<T> vec;
+        vec.reserve(n);
+        for (size_t i = 0; i < n; ++i)
+            vec.push_back(static_cast<T>((static_cast<int>(i) + start) % 17));
+        return vec;
+    }
+
+    // c = a * b computed item by item
+    template <typename T>
+    ModernCpp::NumericVector<T> naive_multiply(ModernCpp::MatrixView<const T> a, ModernCpp::MatrixView<const T> b)
+    {
+        ModernCpp::NumericVector<T> c(a.extent(0) * b.extent(1));
+        for (size_t i = 0; i < a.extent(0); ++i)
+            for (size_t j = 0; j < b.extent(1); ++j)
+                for (size_t k = 0; k < a.extent(1); ++k)
+                    c[i * b.extent(1) + j] += a[i, k] * b[k, j];
+        return c;
+    }
+} // namespace
+
+TEMPLATE_TEST_CASE("NumericVector - aligned storage", "[NumericVector]", int, float, double)
+{
+    using namespace ModernCpp;
+
+    NumericVector<TestType> vec(100);
+    CHECK(reinterpret_cast<std::uintptr_t>(vec.begin()) % 64 == 0);
+
+    Vector<TestType, AlignedAllocator<TestType, 32>> vec_32(7);
+    CHECK(reinterpret_cast<std::uintptr_t>(vec_32.begin()) % 32 == 0);
+
+    vec.reserve(1000);
+    CHECK(reinterpret_cast<std::uintptr_t>(vec.begin()) % 64 == 0);
+}
+
+TEMPLATE_TEST_CASE("Simd - kernels match scalar reference", "[NumericVector][simd]", int, int64_t, float, double)
+{
+    using namespace ModernCpp;
+
+    // sizes not divisible by batch width check the tails
+    for (const size_t n : {0uz, 1uz, 7uz, 16uz, 33uz, 1001uz})
+    {
+        const auto a = make_sequence<TestType>(n);
+        const auto b = make_sequence<TestType>(n, 5);
+
+        for (const auto is : available_instruction_sets())
+        {
+            CAPTURE(n, static_cast<int>(is));
+
+            NumericVector<TestType> out(n);
+
+            Simd::add(a.begin(), b.begin(), out.begin(), n, is);
+            for (size_t i = 0; i < n; ++i)
+                REQUIRE(out[i] == a[i] + b[i]);
+
+            Simd::subtract(a.begin(), b.begin(), out.begin(), n, is);
+            for (size_t i = 0; i < n; ++i)
+                REQUIRE(out[i] == a[i] - b[i]);
+
+            Simd::multiply(a.begin(), b.begin(), out.begin(), n, is);
+            for (size_t i = 0; i < n; ++i)
+                REQUIRE(out[i] == a[i] * b[i]);
+
+            Simd::scale(a.begin(), TestType{3}, out.begin(), n, is);
+            for (size_t i = 0; i < n; ++i)
+                REQUIRE(out[i] == a[i] * TestType{3});
+
+            Simd::offset(a.begin(), TestType{3}, out.begin(), n, is);
+            for (size_t i = 0; i < n; ++i)
+                REQUIRE(out[i] == a[i] + TestType{3});
+
+            Simd::fill(out.begin(), TestType{42}, n, is);
+            for (size_t i = 0; i < n; ++i)
+                REQUIRE(out[i] == TestType{42});
+
+            // small integer values - floating point sums are exact regardless of order
+            TestType expected_sum{};
+            TestType expected_dot{};
+            for (size_t i = 0; i < n; ++i)
+            {
+                expected_sum += a[i];
+                expected_dot += a[i] * b[i];
+            }
+
+            REQUIRE(Simd::sum(a.begin(), n, is) == expected_sum);
+            REQUIRE(Simd::dot(a.begin(), b.begin(), n, is) == expected_dot);
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE("Simd - compaction matches scalar reference", "[NumericVector][simd][erase_if]", int, int64_t, float, double, int16_t)
+{
+    using namespace ModernCpp;
+    using Simd::Comparison;
+
+    for (const size_t n : {0uz, 1uz, 7uz, 16uz, 33uz, 1001uz})
+    {
+        const auto source = make_sequence<TestType>(n);
+
+        for (const auto comparison : {Comparison::equal, Comparison::not_equal, Comparison::less,
+                 Comparison::less_equal, Comparison::greater, Comparison::greater_equal})
+        {
+            const Simd::Compare<TestType> pred{comparison, TestType{8}};
+
+            for (const bool keep : {true, false})
+            {
+                std::vector<TestType> expected;
+                for (const TestType x : source)
+                    if (pred(x) == keep)
+                        expected.push_back(x);
+
+                for (const auto is : available_instruction_sets())
+                {
+                    CAPTURE(n, static_cast<int>(comparison), keep, static_cast<int>(is));
+
+                    NumericVector<TestType> out(n);
+                    TestType* out_end = Simd::compact(source.begin(), n, out.begin(), pred, keep, is);
+                    REQUIRE(std::vector<TestType>(out.begin(), out_end) == expected);
+
+                    // in place
+                    NumericVector<TestType> items = source;
+                    TestType* items_end = Simd::compact(items.begin(), n, items.begin(), pred, keep, is);
+                    REQUIRE(std::vector<TestType>(items.begin(), items_end) == expected);
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("Simd - compaction of NaN", "[NumericVector][simd][erase_if]")
+{
+    using namespace ModernCpp;
+
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    NumericVector<double> vec = {1.0, nan, 3.0, -1.0, nan, 5.0, 0.0, 7.0, nan};
+
+    // NaN is neither less nor greater_equal - it is kept by erase_if of both
+    auto other = vec;
+    vec.erase_if(Simd::less(2.0));
+    other.erase_if(Simd::greater_equal(2.0));
+
+    CHECK(vec.size() == 6);
+    CHECK(other.size() == 6);
+    CHECK(std::isnan(vec[0]));
+    CHECK(std::isnan(other[1]));
+}
+
+TEST_CASE("NumericVector - erase_if & filter_into", "[NumericVector][erase_if]")
+{
+    using namespace ModernCpp;
+
+    NumericVector<int> vec;
+    for (int i = 0; i < 100; ++i)
+        vec.push_back(i);
+
+    SECTION("erase_if compacts in place")
+    {
+        const int* items = vec.begin();
+
+        CHECK(vec.erase_if(Simd::greater_equal(10)) == 90);
+        CHECK(vec.size() == 10);
+        CHECK(vec.capacity() >= 100);
+        CHECK(vec.begin() == items);
+        CHECK(vec[9] == 9);
+    }
+
+    SECTION("filter_into appends selected items")
+    {
+        NumericVector<int> out = {-1};
+        vec.filter_into(out, Simd::less(3));
+        vec.filter_into(out, Simd::equal_to(50));
+
+        CHECK(out == NumericVector<int>{-1, 0, 1, 2, 50});
+        CHECK(vec.size() == 100);
+    }
+
+    SECTION("filter_into of large vector reserves room for selected items only")
+    {
+        NumericVector<int> large;
+        for (int i = 0; i < 100'000; ++i)
+            large.push_back(i);
+
+        NumericVector<int> few;
+        large.filter_into(few, Simd::greater_equal(99'990));
+        CHECK(few.size() == 10);
+        CHECK(few.capacity() < 10'000);
+
+        NumericVector<int> many; // selected items span several chunks
+        large.filter_into(many, [](int x) { return x % 3 == 0; });
+        REQUIRE(many.size() == 33'334);
+        CHECK(many.capacity() < 2 * 33'334 + 10'000);
+        bool in_order = true;
+        for (size_t i = 0; i < many.size(); ++i)
+            in_order = in_order && many[i] == static_cast<int>(3 * i);
+        CHECK(in_order);
+    }
+}
+
+TEST_CASE("Simd - floating point reductions", "[NumericVector][simd]")
+{
+    using namespace ModernCpp;
+
+    NumericVector<double> vec;
+    for (int i = 0; i < 1'000; ++i)
+        vec.push_back(1.0 / (i + 1));
+
+    double expected = 0.0;
+    for (const double x : vec)
+        expected += x;
+
+    for (const auto is : available_instruction_sets())
+        CHECK(Simd::sum(vec.begin(), vec.size(), is) == Catch::Approx(expected).epsilon(1e-12));
+}
+
+TEST_CASE("NumericVector - operators", "[NumericVector]")
+{
+    using namespace ModernCpp;
+
+    const NumericVector<int> a = {1, 2, 3, 4, 5};
+    const NumericVector<int> b = {5, 4, 3, 2, 1};
+
+    CHECK(a + b == NumericVector<int>{6, 6, 6, 6, 6});
+    CHECK(a - b == NumericVector<int>{-4, -2, 0, 2, 4});
+    CHECK(a * b == NumericVector<int>{5, 8, 9, 8, 5});
+    CHECK(a * 2 == NumericVector<int>{2, 4, 6, 8, 10});
+    CHECK(2 * a == NumericVector<int>{2, 4, 6, 8, 10});
+    CHECK(dot(a, b) == 35);
+    CHECK(sum(a) == 15);
+
+    SECTION("compound assignment")
+    {
+        NumericVector<int> c = a;
+        c += b;
+        c *= 10;
+        CHECK(c == NumericVector<int>{60, 60, 60, 60, 60});
+    }
+
+    SECTION("fill")
+    {
+        NumericVector<int> c(9);
+        fill(c, 7);
+        CHECK(sum(c) == 63);
+    }
+
+    SECTION("sizes must match")
+    {
+        const NumericVector<int> c = {1, 2};
+        CHECK_THROWS_AS(a + c, std::invalid_argument);
+        CHECK_THROWS_AS(dot(a, c), std::invalid_argument);
+    }
+
+    SECTION("results are moved - only the left operand of a chain is copied")
+    {
+        using Tracing = BufferedTracing<64>;
+        using TracedVector = Vector<int, AlignedAllocator<int, 64>, Tracing>;
+
+        const TracedVector x = {1, 2, 3, 4, 5};
+        const TracedVector y = {5, 4, 3, 2, 1};
+
+        const auto copies = [] {
+            size_t count = 0;
+            for (size_t i = 0; i < Tracing::size(); ++i)
+                count += Tracing::record(i).event == VectorEvent::copy_constructed;
+            return count;
+        };
+
+        Tracing::clear();
+        const TracedVector sum_xy = x + y;
+        CHECK(copies() == 1);
+
+        Tracing::clear();
+        const TracedVector chain = 2 * (((x + y) - y) * y * 3);
+        CHECK(copies() == 1);
+        CHECK(chain == TracedVector{30, 48, 54, 48, 30});
+    }
+}
+
+TEST_CASE("MdView - layouts", "[MdView]")
+{
+    using namespace ModernCpp;
+
+    NumericVector<int> items(24);
+    for (size_t i = 0; i < items.size(); ++i)
+        items[i] = static_cast<int>(i);
+
+    SECTION("row-major")
+    {
+        const auto matrix = md_view(items, 4, 6);
+        CHECK(matrix.extent(0) == 4);
+        CHECK(matrix.extent(1) == 6);
+        CHECK(matrix[2, 3] == 15);
+
+        matrix[0, 1] = -1;
+        CHECK(items[1] == -1);
+    }
+
+    SECTION("column-major")
+    {
+        const auto matrix = md_view<ColumnMajor>(items, 4, 6);
+        CHECK(matrix[2, 3] == 14);
+        CHECK(matrix.stride(0) == 1);
+        CHECK(matrix.stride(1) == 4);
+    }
+
+    SECTION("rank 3")
+    {
+        const MdView<const int, 3> tensor = md_view(std::as_const(items), 2, 3, 4);
+        CHECK(tensor[1, 2, 3] == 23);
+        CHECK(tensor.size() == 24);
+    }
+
+    SECTION("strided views")
+    {
+        const auto matrix = md_view(items, 4, 6);
+
+        const auto block = matrix.subview({1, 2}, {2, 3});
+        CHECK(block.extent(0) == 2);
+        CHECK(block[0, 0] == 8);
+        CHECK(block[1, 2] == 16);
+
+        const MatrixView<const int, Strided> transposed = matrix.transposed();
+        CHECK(transposed.extent(0) == 6);
+        CHECK(transposed[3, 2] == 15);
+
+        // every other column
+        const MatrixView<int, Strided> even_columns{items.begin(), {4, 3}, {6, 2}};
+        CHECK(even_columns[3, 2] == 22);
+    }
+
+    SECTION("extents must match size of vector")
+    {
+        CHECK_THROWS_AS(md_view(items, 5, 5), std::invalid_argument);
+    }
+}
+
+TEMPLATE_TEST_CASE("MdView - multiply matches naive reference", "[MdView][simd]", int, float, double)
+{
+    using namespace ModernCpp;
+
+    // small integer values - floating point results are exact regardless of order of additions
+    const auto make_matrix = [](size_t rows, size_t columns, int start) {
+        auto items = make_sequence<TestType>(rows * columns, start);
+        for (auto& item : items)
+            item -= TestType{8};
+        return items;
+    };
+
+    SECTION("row-major - sizes crossing block boundaries")
+    {
+        for (const auto [m, k, n] : {std::array{1uz, 1uz, 1uz}, {5uz, 7uz, 3uz}, {131uz, 257uz, 515uz}})
+        {
+            const auto a = make_matrix(m, k, 1);
+            const auto b = make_matrix(k, n, 5);
+            const auto expected = naive_multiply<TestType>(md_view(a, m, k), md_view(b, k, n));
+
+            for (const auto is : available_instruction_sets())
+            {
+                CAPTURE(m, k, n, static_cast<int>(is));
+
+                NumericVector<TestType> c(m * n);
+                multiply(md_view(a, m, k), md_view(b, k, n), md_view(c, m, n), is);
+                REQUIRE(c == expected);
+            }
+        }
+    }
+
+    SECTION("mixed layouts")
+    {
+        constexpr size_t m = 37, k = 45, n = 29;
+
+        const auto a = make_matrix(m, k, 1);
+        const auto b_transposed = make_matrix(n, k, 5);
+
+        const auto a_view = md_view(a, m, k);
+        const auto b_view = md_view(b_transposed, n, k).transposed();
+
+        NumericVector<TestType> b(k * n);
+        transpose(md_view(b_transposed, n, k), md_view(b, k, n));
+        const auto expected = naive_multiply<TestType>(a_view, md_view(b, k, n));
+
+        NumericVector<TestType> a_column_major(m * k);
+        transpose(a_view, md_view<ColumnMajor>(a_column_major, m, k).transposed());
+
+        NumericVector<TestType> c(m * n);
+        const auto c_view = md_view<ColumnMajor>(c, m, n);
+        multiply(md_view<ColumnMajor>(std::as_const(a_column_major), m, k), b_view, c_view);
+
+        for (size_t i = 0; i < m; ++i)
+            for (size_t j = 0; j < n; ++j)
+                REQUIRE(c_view[i, j] == expected[i * n + j]);
+    }
+
+    SECTION("extents must match")
+    {
+        NumericVector<TestType> a(6), b(6), c(4);
+        CHECK_THROWS_AS(multiply(md_view(a, 2, 3), md_view(b, 2, 3), md_view(c, 2, 2)), std::invalid_argument);
+    }
+}
+
+TEST_CASE("MdView - transpose & reductions", "[MdView][simd]")
+{
+    using namespace ModernCpp;
+
+    constexpr size_t rows = 45, columns = 70;
+
+    NumericVector<double> items(rows * columns);
+    for (size_t i = 0; i < items.size(); ++i)
+        items[i] = static_cast<double>(i % 13);
+
+    const auto matrix = md_view(std::as_const(items), rows, columns);
+
+    NumericVector<double> transposed(rows * columns);
+    transpose(matrix, md_view(transposed, columns, rows));
+    for (size_t i = 0; i < rows; ++i)
+        for (size_t j = 0; j < columns; ++j)
+            REQUIRE(transposed[j * rows + i] == matrix[i, j]);
+
+    std::vector<double> expected_rows(rows), expected_columns(columns);
+    double expected_sum = 0;
+    for (size_t i = 0; i < rows; ++i)
+        for (size_t j = 0; j < columns; ++j)
+        {
+            expected_rows[i] += matrix[i, j];
+            expected_columns[j] += matrix[i, j];
+            expected_sum += matrix[i, j];
+        }
+
+    // same matrix seen through row-major, column-major & strided views
+    const auto column_major = md_view<ColumnMajor>(std::as_const(transposed), rows, columns);
+    const MatrixView<const double, Strided> strided = matrix.subview({0, 0}, {rows, columns});
+
+    std::vector<double> sums_of_rows(rows), sums_of_columns(columns);
+
+    row_sums(matrix, std::span{sums_of_rows});
+    CHECK(sums_of_rows == expected_rows);
+    row_sums(column_major, std::span{sums_of_rows});
+    CHECK(sums_of_rows == expected_rows);
+    row_sums(strided.transposed().transposed(), std::span{sums_of_rows});
+    CHECK(sums_of_rows == expected_rows);
+
+    column_sums(matrix, std::span{sums_of_columns});
+    CHECK(sums_of_columns == expected_columns);
+    column_sums(column_major, std::span{sums_of_columns});
+    CHECK(sums_of_columns == expected_columns);
+
+    CHECK(sum(matrix) == expected_sum);
+    CHECK(sum(column_major) == expected_sum);
+    CHECK(sum(matrix.subview({1, 1}, {2, 2})) == matrix[1, 1] + matrix[1, 2] + matrix[2, 1] + matrix[2, 2]);
+
+    CHECK_THROWS_AS(row_sums(matrix, std::span{sums_of_columns}), std::invalid_argument);
+}
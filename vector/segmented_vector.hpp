@@ -0,0 +1,384 @@
+#ifndef SEGMENTED_VECTOR_HPP
+#define SEGMENTED_VECTOR_HPP
+
+#include <algorithm>
+#include <bit>
+#include <compare>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ModernCpp
+{
+    // Vector storing items in fixed-size segments (SegmentBytes each) indexed through a directory
+    // - push_back never moves existing items - pointers & references to items stay valid
+    // - growing costs at most one segment allocation - no latency spikes caused by relocation
+    template <typename T, size_t SegmentBytes = 4096>
+    class SegmentedVector
+    {
+        template <bool IsConst>
+        class Iterator;
+
+    public:
+        using value_type = T;
+        using iterator = Iterator<false>;
+        using const_iterator = Iterator<true>;
+
+        // power of 2 - index is split into segment & offset with shift and mask
+        static constexpr size_t segment_capacity = std::bit_floor(std::max<size_t>(1, SegmentBytes / sizeof(T)));
+
+        SegmentedVector() noexcept = default;
+
+        // constructors delegate to default one - segments are released if construction of items throws
+        explicit SegmentedVector(size_t size)
+            : SegmentedVector()
+        {
+            reserve(size);
+            for (size_t segment = 0; size_ < size; ++segment)
+            {
+                const size_t n = std::min(segment_capacity, size - size_);
+                std::uninitialized_value_construct_n(segments_[segment], n);
+                size_ += n;
+            }
+        }
+
+        SegmentedVector(std::initializer_list<T> items)
+            : SegmentedVector()
+        {
+            reserve(items.size());
+            construct_back(items.begin(), items.size());
+        }
+
+        // copy constructor
+        SegmentedVector(const SegmentedVector& source)
+            : SegmentedVector()
+        {
+            reserve(source.size());
+            for (size_t segment = 0; size_ < source.size(); ++segment)
+                construct_back(source.segments_[segment], std::min(segment_capacity, source.size() - size_));
+        }
+
+        // copy assignment
+        SegmentedVector& operator=(const SegmentedVector& source)
+        {
+            if (this != &source) // avoiding self assignment
+            {
+                SegmentedVector temp(source); // cc
+                swap(temp);
+            }
+
+            return *this;
+        }
+
+        // move constructor - segments are stolen
+        SegmentedVector(SegmentedVector&& source) noexcept
+            : segments_{std::move(source.segments_)}
+            , size_{std::exchange(source.size_, 0)}
+        {
+        }
+
+        // move assignment
+        SegmentedVector& operator=(SegmentedVector&& source) noexcept
+        {
+            if (this != &source) // avoiding self assignment
+            {
+                SegmentedVector temp(std::move(source));
+                swap(temp);
+            }
+
+            return *this;
+        }
+
+        ~SegmentedVector() noexcept
+        {
+            destroy_and_deallocate();
+        }
+
+        void swap(SegmentedVector& that) noexcept
+        {
+            std::swap(this->segments_, that.segments_);
+            std::swap(this->size_, that.size_);
+        }
+
+        size_t size() const noexcept
+        {
+            return size_;
+        }
+
+        size_t capacity() const noexcept
+        {
+            return segments_.size() * segment_capacity;
+        }
+
+        bool empty() const noexcept
+        {
+            return size_ == 0;
+        }
+
+        // allocates segments up front - existing items are never moved
+        void reserve(size_t new_capacity)
+        {
+            const size_t segment_count = (new_capacity + segment_capacity - 1) / segment_capacity;
+            segments_.reserve(segment_count);
+            while (segments_.size() < segment_count)
+                add_segment();
+        }
+
+        // releases empty segments
+        void shrink_to_fit()
+        {
+            const size_t segment_count = (size_ + segment_capacity - 1) / segment_capacity;
+            for (size_t segment = segment_count; segment < segments_.size(); ++segment)
+                std::allocator<T>{}.deallocate(segments_[segment], segment_capacity);
+            segments_.resize(segment_count);
+            segments_.shrink_to_fit();
+        }
+
+        iterator begin() noexcept
+        {
+            return iterator{segments_.data(), 0};
+        }
+
+        iterator end() noexcept
+        {
+            return iterator{segments_.data(), size_};
+        }
+
+        const_iterator begin() const noexcept
+        {
+            return const_iterator{segments_.data(), 0};
+        }
+
+        const_iterator end() const noexcept
+        {
+            return const_iterator{segments_.data(), size_};
+        }
+
+        const_iterator cbegin() const noexcept
+        {
+            return begin();
+        }
+
+        const_iterator cend() const noexcept
+        {
+            return end();
+        }
+
+        T& operator[](size_t index) noexcept
+        {
+            return segments_[index / segment_capacity][index % segment_capacity];
+        }
+
+        const T& operator[](size_t index) const noexcept
+        {
+            return segments_[index / segment_capacity][index % segment_capacity];
+        }
+
+        // segments are compared as contiguous ranges
+        bool operator==(const SegmentedVector& that) const
+        {
+            if (size_ != that.size_)
+                return false;
+
+            for (size_t first = 0, segment = 0; first < size_; first += segment_capacity, ++segment)
+            {
+                const size_t n = std::min(segment_capacity, size_ - first);
+                if (!std::equal(segments_[segment], segments_[segment] + n, that.segments_[segment]))
+                    return false;
+            }
+
+            return true;
+        }
+
+        template <typename TItem>
+        void push_back(TItem&& item)
+        {
+            emplace_back(std::forward<TItem>(item));
+        }
+
+        template <typename... TArgs>
+        T& emplace_back(TArgs&&... args)
+        {
+            if (size_ == capacity())
+                add_segment();
+
+            T* item = std::construct_at(&(*this)[size_], std::forward<TArgs>(args)...);
+            ++size_;
+            return *item;
+        }
+
+    private:
+        // directory - holds only pointers, so its reallocation is cheap
+        std::vector<T*> segments_;
+        size_t size_{};
+
+        void add_segment()
+        {
+            T* segment = std::allocator<T>{}.allocate(segment_capacity);
+            try
+            {
+                segments_.push_back(segment);
+            }
+            catch (...)
+            {
+                std::allocator<T>{}.deallocate(segment, segment_capacity);
+                throw;
+            }
+        }
+
+        // copy constructs n items from first at the end - storage must be reserved
+        template <typename InputIterator>
+        void construct_back(InputIterator first, size_t n)
+        {
+            while (n > 0)
+            {
+                const size_t offset = size_ % segment_capacity;
+                const size_t count = std::min(segment_capacity - offset, n);
+                T* dest = segments_[size_ / segment_capacity] + offset;
+
+                first = std::ranges::uninitialized_copy_n(first, count, dest, dest + count).in;
+                size_ += count;
+                n -= count;
+            }
+        }
+
+        void destroy_and_deallocate() noexcept
+        {
+            for (size_t first = 0, segment = 0; first < size_; first += segment_capacity, ++segment)
+                std::destroy_n(segments_[segment], std::min(segment_capacity, size_ - first));
+
+            for (T* segment : segments_)
+                std::allocator<T>{}.deallocate(segment, segment_capacity);
+        }
+    };
+
+    // random access iterator - position is kept as index, so it is not invalidated by push_back
+    // as long as the directory is not reallocated
+    template <typename T, size_t SegmentBytes>
+    template <bool IsConst>
+    class SegmentedVector<T, SegmentBytes>::Iterator
+    {
+        using Segment = std::conditional_t<IsConst, T* const, T*>;
+
+    public:
+        using iterator_concept = std::random_access_iterator_tag;
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<IsConst, const T*, T*>;
+        using reference = std::conditional_t<IsConst, const T&, T&>;
+
+        Iterator() noexcept = default;
+
+        Iterator(Segment* segments, size_t index) noexcept
+            : segments_{segments}
+            , index_{index}
+        {
+        }
+
+        // iterator -> const_iterator
+        template <bool IsOtherConst>
+            requires(IsConst && !IsOtherConst)
+        Iterator(const Iterator<IsOtherConst>& other) noexcept
+            : segments_{other.segments_}
+            , index_{other.index_}
+        {
+        }
+
+        reference operator*() const noexcept
+        {
+            return segments_[index_ / segment_capacity][index_ % segment_capacity];
+        }
+
+        pointer operator->() const noexcept
+        {
+            return &**this;
+        }
+
+        reference operator[](difference_type n) const noexcept
+        {
+            return *(*this + n);
+        }
+
+        Iterator& operator++() noexcept
+        {
+            ++index_;
+            return *this;
+        }
+
+        Iterator operator++(int) noexcept
+        {
+            Iterator temp = *this;
+            ++index_;
+            return temp;
+        }
+
+        Iterator& operator--() noexcept
+        {
+            --index_;
+            return *this;
+        }
+
+        Iterator operator--(int) noexcept
+        {
+            Iterator temp = *this;
+            --index_;
+            return temp;
+        }
+
+        Iterator& operator+=(difference_type n) noexcept
+        {
+            index_ += n;
+            return *this;
+        }
+
+        Iterator& operator-=(difference_type n) noexcept
+        {
+            index_ -= n;
+            return *this;
+        }
+
+        friend Iterator operator+(Iterator it, difference_type n) noexcept
+        {
+            return it += n;
+        }
+
+        friend Iterator operator+(difference_type n, Iterator it) noexcept
+        {
+            return it += n;
+        }
+
+        friend Iterator operator-(Iterator it, difference_type n) noexcept
+        {
+            return it -= n;
+        }
+
+        friend difference_type operator-(const Iterator& a, const Iterator& b) noexcept
+        {
+            return static_cast<difference_type>(a.index_) - static_cast<difference_type>(b.index_);
+        }
+
+        friend bool operator==(const Iterator& a, const Iterator& b) noexcept
+        {
+            return a.index_ == b.index_;
+        }
+
+        friend auto operator<=>(const Iterator& a, const Iterator& b) noexcept
+        {
+            return a.index_ <=> b.index_;
+        }
+
+    private:
+        template <bool>
+        friend class Iterator;
+
+        Segment* segments_{};
+        size_t index_{};
+    };
+} // namespace ModernCpp
+
+#endif // SEGMENTED_VECTOR_HPP
@@ -0,0 +1,296 @@
+#ifndef SMALL_VECTOR_HPP
+#define SMALL_VECTOR_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace ModernCpp
+{
+    // Vector with inline storage for up to N items - heap is used only when it grows past N
+    template <typename T, size_t N>
+    class SmallVector
+    {
+        static_assert(N > 0, "inline capacity must not be zero");
+
+    public:
+        using value_type = T;
+        using iterator = T*;
+        using const_iterator = const T*;
+
+        static constexpr size_t inline_capacity = N;
+        static constexpr size_t growth_factor = 2;
+
+        SmallVector() noexcept = default;
+
+        // constructors delegate to the default one - if an item throws after reserve() has spilled to heap,
+        // the object is already constructed and its destructor releases the heap buffer
+        explicit SmallVector(size_t size)
+            : SmallVector()
+        {
+            reserve(size);
+            std::uninitialized_value_construct_n(items_, size);
+            size_ = size;
+        }
+
+        SmallVector(std::initializer_list<T> items)
+            : SmallVector()
+        {
+            reserve(items.size());
+            std::uninitialized_copy(items.begin(), items.end(), items_);
+            size_ = items.size();
+        }
+
+        // copy constructor
+        SmallVector(const SmallVector& source)
+            : SmallVector()
+        {
+            reserve(source.size());
+            std::uninitialized_copy(source.begin(), source.end(), items_);
+            size_ = source.size();
+        }
+
+        // copy assignment
+        SmallVector& operator=(const SmallVector& source)
+        {
+            if (this != &source) // avoiding self assignment
+            {
+                SmallVector temp(source); // cc
+                swap(temp);
+            }
+
+            return *this;
+        }
+
+        // move constructor - heap buffer is stolen, inline items are moved one by one
+        SmallVector(SmallVector&& source) noexcept(std::is_nothrow_move_constructible_v<T>)
+        {
+            take_from(source);
+        }
+
+        // move assignment
+        SmallVector& operator=(SmallVector&& source) noexcept(std::is_nothrow_move_constructible_v<T>)
+        {
+            if (this != &source) // avoiding self assignment
+            {
+                clear_and_deallocate();
+                take_from(source);
+            }
+
+            return *this;
+        }
+
+        ~SmallVector() noexcept
+        {
+            clear_and_deallocate();
+        }
+
+        void swap(SmallVector& that) noexcept(std::is_nothrow_move_constructible_v<T>)
+        {
+            if (!this->is_inline() && !that.is_inline())
+            {
+                std::swap(this->size_, that.size_);
+                std::swap(this->capacity_, that.capacity_);
+                std::swap(this->items_, that.items_);
+                return;
+            }
+
+            SmallVector temp(std::move(that));
+            that = std::move(*this);
+            *this = std::move(temp);
+        }
+
+        size_t size() const noexcept
+        {
+            return size_;
+        }
+
+        size_t capacity() const noexcept
+        {
+            return capacity_;
+        }
+
+        bool empty() const noexcept
+        {
+            return size_ == 0;
+        }
+
+        // true while items are kept in the inline buffer
+        bool is_inline() const noexcept
+        {
+            return items_ == inline_items();
+        }
+
+        void reserve(size_t new_capacity)
+        {
+            if (new_capacity > capacity_)
+                reallocate(new_capacity);
+        }
+
+        iterator begin() noexcept
+        {
+            return items_;
+        }
+
+        iterator end() noexcept
+        {
+            return items_ + size_;
+        }
+
+        const_iterator begin() const noexcept
+        {
+            return items_;
+        }
+
+        const_iterator end() const noexcept
+        {
+            return items_ + size_;
+        }
+
+        const_iterator cbegin() const noexcept
+        {
+            return items_;
+        }
+
+        const_iterator cend() const noexcept
+        {
+            return items_ + size_;
+        }
+
+        T& operator[](size_t index) noexcept
+        {
+            return items_[index];
+        }
+
+        const T& operator[](size_t index) const noexcept
+        {
+            return items_[index];
+        }
+
+        bool operator==(const SmallVector& that) const
+        {
+            return std::ranges::equal(*this, that);
+        }
+
+        template <typename TItem>
+        void push_back(TItem&& item)
+        {
+            emplace_back(std::forward<TItem>(item));
+        }
+
+        template <typename... TArgs>
+        T& emplace_back(TArgs&&... args)
+        {
+            if (size_ < capacity_)
+            {
+                std::construct_at(items_ + size_, std::forward<TArgs>(args)...);
+                return items_[size_++];
+            }
+
+            // new item is created before the old ones are relocated - args may refer to an item of this vector
+            const size_t new_capacity = capacity_ * growth_factor;
+            T* new_items = std::allocator<T>{}.allocate(new_capacity);
+            try
+            {
+                std::construct_at(new_items + size_, std::forward<TArgs>(args)...);
+            }
+            catch (...)
+            {
+                std::allocator<T>{}.deallocate(new_items, new_capacity);
+                throw;
+            }
+
+            try
+            {
+                relocate_to(new_items);
+            }
+            catch (...)
+            {
+                std::destroy_at(new_items + size_);
+                std::allocator<T>{}.deallocate(new_items, new_capacity);
+                throw;
+            }
+
+            capacity_ = new_capacity;
+            return items_[size_++];
+        }
+
+    private:
+        T* items_{inline_items()};
+        size_t size_{};
+        size_t capacity_{N};
+        alignas(T) std::byte inline_buffer_[N * sizeof(T)];
+
+        T* inline_items() noexcept
+        {
+            return reinterpret_cast<T*>(inline_buffer_);
+        }
+
+        const T* inline_items() const noexcept
+        {
+            return reinterpret_cast<const T*>(inline_buffer_);
+        }
+
+        void clear_and_deallocate() noexcept
+        {
+            std::destroy(begin(), end());
+            if (!is_inline())
+                std::allocator<T>{}.deallocate(items_, capacity_);
+
+            items_ = inline_items();
+            size_ = 0;
+            capacity_ = N;
+        }
+
+        // expects *this to be empty and inline
+        void take_from(SmallVector& source) noexcept(std::is_nothrow_move_constructible_v<T>)
+        {
+            if (source.is_inline())
+            {
+                std::uninitialized_move(source.begin(), source.end(), items_);
+                size_ = source.size_;
+                source.clear_and_deallocate();
+            }
+            else
+            {
+                items_ = std::exchange(source.items_, source.inline_items());
+                size_ = std::exchange(source.size_, 0);
+                capacity_ = std::exchange(source.capacity_, N);
+            }
+        }
+
+        void reallocate(size_t new_capacity)
+        {
+            T* new_items = std::allocator<T>{}.allocate(new_capacity);
+            try
+            {
+                relocate_to(new_items);
+            }
+            catch (...)
+            {
+                std::allocator<T>{}.deallocate(new_items, new_capacity);
+                throw;
+            }
+            capacity_ = new_capacity;
+        }
+
+        // moves (or copies if move may throw) live items to new heap storage and releases the old one
+        void relocate_to(T* new_items)
+        {
+            if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>)
+                std::uninitialized_move(begin(), end(), new_items);
+            else
+                std::uninitialized_copy(begin(), end(), new_items);
+
+            std::destroy(begin(), end());
+            if (!is_inline())
+                std::allocator<T>{}.deallocate(items_, capacity_);
+            items_ = new_items;
+        }
+    };
+} // namespace ModernCpp
+
+#endif // SMALL_VECTOR_HPP
@@ -0,0 +1,164 @@
+#ifndef SORTED_INDEX_HPP
+#define SORTED_INDEX_HPP
+
+#include "numeric_vector.hpp"
+#include "vector.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <ranges>
+#include <span>
+
+namespace ModernCpp
+{
+    // Read-only set of keys laid out in Eytzinger (BFS) order for fast lookups
+    // - node k has children 2k and 2k + 1 - the top levels of the tree share a few cache lines
+    // - search is branch free: the loop runs the same number of steps for every key
+    // - descendants a few levels down are prefetched, so memory latency of the next steps is hidden
+    // - batch lookups walk a group of queries level by level - their cache misses overlap
+    template <std::totally_ordered T>
+    class SortedIndex
+    {
+    public:
+        using value_type = T;
+
+        static constexpr size_t batch_group_size = 16;
+
+        SortedIndex() = default;
+
+        // keys are copied and sorted - duplicates are allowed
+        template <std::ranges::input_range R>
+            requires std::convertible_to<std::ranges::range_reference_t<R>, T>
+        explicit SortedIndex(R&& keys)
+        {
+            Vector<T> sorted(from_range, std::forward<R>(keys));
+            std::ranges::sort(sorted);
+
+            size_ = sorted.size();
+            keys_ = KeyVector(size_ + 1); // keys_[0] is not used - root is at index 1
+            size_t next = 0;
+            build(sorted, next, 1);
+
+            full_levels_ = std::bit_width(size_ + 1) - 1;
+        }
+
+        size_t size() const noexcept
+        {
+            return size_;
+        }
+
+        bool empty() const noexcept
+        {
+            return size_ == 0;
+        }
+
+        // the smallest key not less than key - nullptr if there is none
+        const T* lower_bound(const T& key) const
+        {
+            if (size_ == 0)
+                return nullptr;
+
+            size_t k = 1;
+            for (size_t level = 0; level < full_levels_; ++level)
+                k = step(k, key);
+            k = last_step(k, key);
+
+            return found(k);
+        }
+
+        bool contains(const T& key) const
+        {
+            const T* item = lower_bound(key);
+            return item && !(key < *item);
+        }
+
+        // results[i] = lower_bound(queries[i]) - groups of queries are searched together
+        void lower_bound(std::span<const T> queries, std::span<const T*> results) const
+        {
+            assert(queries.size() <= results.size());
+
+            size_t first = 0;
+            for (; first + batch_group_size <= queries.size(); first += batch_group_size)
+                lower_bound_group<batch_group_size>(queries.data() + first, results.data() + first);
+
+            for (; first < queries.size(); ++first)
+                results[first] = lower_bound(queries[first]);
+        }
+
+    private:
+        using KeyVector = Vector<T, AlignedAllocator<T, 64>>;
+
+        // descendants 4 levels down are adjacent - for 4-byte keys they fill one cache line
+        static constexpr size_t prefetch_stride = 16;
+
+        KeyVector keys_;
+        size_t size_{};
+        size_t full_levels_{}; // levels 0..full_levels_-1 of the tree have no missing nodes
+
+        // in-order traversal of the implicit tree assigns sorted keys to nodes
+        void build(const Vector<T>& sorted, size_t& next, size_t k)
+        {
+            if (k > size_)
+                return;
+
+            build(sorted, next, 2 * k);
+            keys_[k] = sorted[next++];
+            build(sorted, next, 2 * k + 1);
+        }
+
+        [[gnu::always_inline]] size_t step(size_t k, const T& key) const
+        {
+            prefetch(k * prefetch_stride);
+            return 2 * k + (keys_[k] < key);
+        }
+
+        // node on the last (partial) level may not exist - index is clamped, so the read stays in bounds
+        [[gnu::always_inline]] size_t last_step(size_t k, const T& key) const
+        {
+            const size_t next = 2 * k + (keys_[std::min(k, size_)] < key);
+            return k <= size_ ? next : k;
+        }
+
+        // path ends below a leaf - trailing right turns (ones) and the final left turn lead back to the answer
+        const T* found(size_t k) const
+        {
+            k >>= std::countr_one(k) + 1;
+            return k == 0 ? nullptr : &keys_[k];
+        }
+
+        void prefetch(size_t index) const
+        {
+            // address may be past the end - prefetch does not fault
+            __builtin_prefetch(reinterpret_cast<const void*>(reinterpret_cast<uintptr_t>(keys_.begin()) + index * sizeof(T)));
+        }
+
+        template <size_t N>
+        void lower_bound_group(const T* queries, const T** results) const
+        {
+            if (size_ == 0)
+            {
+                std::fill_n(results, N, nullptr);
+                return;
+            }
+
+            size_t k[N];
+            std::fill_n(k, N, 1);
+
+            for (size_t level = 0; level < full_levels_; ++level)
+                for (size_t i = 0; i < N; ++i)
+                    k[i] = step(k[i], queries[i]);
+
+            for (size_t i = 0; i < N; ++i)
+                results[i] = found(last_step(k[i], queries[i]));
+        }
+    };
+
+    template <std::ranges::input_range R>
+    SortedIndex(R&&) -> SortedIndex<std::ranges::range_value_t<R>>;
+} // namespace ModernCpp
+
+#endif // SORTED_INDEX_HPP
@@ -0,0 +1,786 @@
+#ifndef VECTOR_HPP
+#define VECTOR_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+#include "vector_parallel.hpp"
+#include "vector_tracing.hpp"
+
+namespace ModernCpp
+{
+    // Type can be relocated (moved to new storage + destroyed) with memcpy.
+    // May be specialized for types which are not trivially copyable but do not depend on their address.
+    template <typename T>
+    struct is_trivially_relocatable : std::is_trivially_copyable<T>
+    {
+    };
+
+    template <typename T>
+    constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<T>::value;
+
+    // Items of type can be compared with memcmp - equality is the same as equality of object representations.
+    // Floating point types are excluded (0.0 == -0.0, NaN != NaN).
+    // May be specialized for trivially copyable aggregates without padding and with defaulted operator==.
+    template <typename T>
+    struct is_trivially_equality_comparable
+        : std::bool_constant<std::is_integral_v<T> || std::is_enum_v<T> || std::is_pointer_v<T>>
+    {
+    };
+
+    template <typename T>
+    constexpr bool is_trivially_equality_comparable_v = is_trivially_equality_comparable<T>::value;
+
+#if __cpp_lib_containers_ranges >= 202202L
+    using std::from_range;
+    using std::from_range_t;
+#else
+    // disambiguation tag for construction from a range - same as std::from_range in C++23
+    struct from_range_t
+    {
+        explicit from_range_t() = default;
+    };
+
+    inline constexpr from_range_t from_range{};
+#endif
+
+    // range whose items can be used to construct items of container
+    template <typename R, typename T>
+    concept container_compatible_range = std::ranges::input_range<R> && std::convertible_to<std::ranges::range_reference_t<R>, T>;
+
+    namespace Detail
+    {
+        // Copies items for which pred(item) == keep to dest (dest may be equal to first) - returns end of output.
+        // Every item is written and the output pointer is advanced by the result of pred - there are no branches
+        // to mispredict, but dest must have room for all items from [first, last).
+        // Vector calls it unqualified, so predicates may provide vectorized overloads found by ADL.
+        template <typename T, typename Predicate>
+        T* compact_items(const T* first, const T* last, T* dest, Predicate pred, bool keep)
+        {
+            for (; first != last; ++first)
+            {
+                const T item = *first; // dest may point to the item
+                *dest = item;
+                dest += (static_cast<bool>(pred(item)) == keep);
+            }
+            return dest;
+        }
+    } // namespace Detail
+
+    template <typename T, typename Allocator = std::allocator<T>, typename Tracing = NoTracing>
+    class Vector
+    {
+        using alloc_traits = std::allocator_traits<Allocator>;
+
+        static_assert(std::is_same_v<typename alloc_traits::value_type, T>, "Allocator::value_type must be T");
+        static_assert(std::is_same_v<typename alloc_traits::pointer, T*>, "fancy pointers are not supported");
+
+        // items may be copied/relocated with memcpy instead of allocator's construct
+        static constexpr bool is_bulk_copyable = std::is_trivially_copyable_v<T> && !std::uses_allocator_v<T, Allocator>;
+        static constexpr bool is_bulk_relocatable = is_trivially_relocatable_v<T> && !std::uses_allocator_v<T, Allocator>;
+
+        // items compacted per step of filter_into - bounds spare capacity reserved in output
+        static constexpr size_t filter_chunk_size = 4096;
+
+    public:
+        using value_type = T;
+        using allocator_type = Allocator;
+        using iterator = T*;
+        using const_iterator = const T*;
+
+        static constexpr size_t growth_factor = 2;
+
+        Vector() noexcept(noexcept(Allocator())) = default;
+
+        explicit Vector(const Allocator& alloc) noexcept
+            : alloc_{alloc}
+        {
+        }
+
+        explicit Vector(size_t size, const Allocator& alloc = Allocator())
+            : Vector(size, alloc, reserve_tag{})
+        {
+            construct_n(items_, size);
+            size_ = size;
+            trace(VectorEvent::constructed);
+        }
+
+        Vector(std::initializer_list<T> items, const Allocator& alloc = Allocator())
+            : Vector(items.size(), alloc, reserve_tag{})
+        {
+            construct_from(items.begin(), items.end(), items_);
+            size_ = items.size();
+            trace(VectorEvent::constructed);
+        }
+
+        // Vector<int> vec(ModernCpp::from_range, std::views::iota(0, 100));
+        template <container_compatible_range<T> R>
+        Vector(from_range_t, R&& range, const Allocator& alloc = Allocator())
+            : Vector(alloc)
+        {
+            append_range(std::forward<R>(range));
+            trace(VectorEvent::constructed);
+        }
+
+        // copy constructor
+        Vector(const Vector& source)
+            : Vector(source, alloc_traits::select_on_container_copy_construction(source.alloc_))
+        {
+        }
+
+        Vector(const Vector& source, const Allocator& alloc)
+            : Vector(source.size(), alloc, reserve_tag{})
+        {
+            construct_from(source.begin(), source.end(), items_);
+            size_ = source.size();
+            trace(VectorEvent::copy_constructed);
+        }
+
+        // parallel copy constructor - for very large vectors
+        Vector(const Vector& source, const Parallel& policy)
+            : Vector(source.size(), alloc_traits::select_on_container_copy_construction(source.alloc_), reserve_tag{})
+        {
+            parallel_construct_from(source.items_, items_, source.size(), policy);
+            size_ = source.size();
+            trace(VectorEvent::copy_constructed);
+        }
+
+        // copy assignment
+        Vector& operator=(const Vector& source)
+        {
+            if (this != &source) // avoiding self assignment
+            {
+                if constexpr (alloc_traits::propagate_on_container_copy_assignment::value)
+                {
+                    if (alloc_ != source.alloc_) // memory owned by current allocator must be released by it
+                    {
+                        destroy_and_deallocate();
+                        items_ = nullptr;
+                        size_ = capacity_ = 0;
+                    }
+                    alloc_ = source.alloc_;
+                }
+
+                assign_items(source.begin(), source.end(), source.size());
+            }
+
+            trace(VectorEvent::copy_assigned);
+
+            return *this;
+        }
+
+        // move constructor
+        Vector(Vector&& source) noexcept
+            : alloc_{std::move(source.alloc_)}
+            , size_{std::exchange(source.size_, 0)}
+            , capacity_{std::exchange(source.capacity_, 0)}
+            , items_{std::exchange(source.items_, nullptr)}
+        {
+            trace(VectorEvent::move_constructed);
+        }
+
+        // move assignment
+        Vector& operator=(Vector&& source) noexcept(
+            alloc_traits::propagate_on_container_move_assignment::value || alloc_traits::is_always_equal::value)
+        {
+            if (this != &source) // avoiding self assignment
+            {
+                if (alloc_traits::propagate_on_container_move_assignment::value || alloc_ == source.alloc_)
+                {
+                    destroy_and_deallocate();
+
+                    if constexpr (alloc_traits::propagate_on_container_move_assignment::value)
+                        alloc_ = std::move(source.alloc_);
+
+                    size_ = std::exchange(source.size_, 0);
+                    capacity_ = std::exchange(source.capacity_, 0);
+                    items_ = std::exchange(source.items_, nullptr);
+                }
+                else // storage of source cannot be adopted - items are moved one by one
+                {
+                    assign_items(std::make_move_iterator(source.begin()), std::make_move_iterator(source.end()), source.size());
+                }
+            }
+
+            trace(VectorEvent::move_assigned);
+
+            return *this;
+        }
+
+        ~Vector() noexcept
+        {
+            trace(VectorEvent::destroyed);
+            destroy_and_deallocate();
+        }
+
+        void swap(Vector& that) noexcept
+        {
+            if constexpr (alloc_traits::propagate_on_container_swap::value)
+            {
+                using std::swap;
+                swap(this->alloc_, that.alloc_);
+            }
+            else
+            {
+                assert(this->alloc_ == that.alloc_ && "swapping vectors with unequal allocators is undefined");
+            }
+
+            std::swap(this->size_, that.size_);
+            std::swap(this->capacity_, that.capacity_);
+            std::swap(this->items_, that.items_);
+        }
+
+        allocator_type get_allocator() const noexcept
+        {
+            return alloc_;
+        }
+
+        size_t size() const noexcept
+        {
+            return size_;
+        }
+
+        size_t capacity() const noexcept
+        {
+            return capacity_;
+        }
+
+        bool empty() const noexcept
+        {
+            return size_ == 0;
+        }
+
+        void reserve(size_t new_capacity)
+        {
+            if (new_capacity > capacity_)
+                reallocate(new_capacity);
+        }
+
+        void shrink_to_fit()
+        {
+            if (capacity_ > size_)
+                reallocate(size_);
+        }
+
+        iterator begin() noexcept
+        {
+            return items_;
+        }
+
+        iterator end() noexcept
+        {
+            return items_ + size_;
+        }
+
+        const_iterator begin() const noexcept
+        {
+            return items_;
+        }
+
+        const_iterator end() const noexcept
+        {
+            return items_ + size_;
+        }
+
+        const_iterator cbegin() const noexcept
+        {
+            return items_;
+        }
+
+        const_iterator cend() const noexcept
+        {
+            return items_ + size_;
+        }
+
+        T& operator[](size_t index) noexcept
+        {
+            return items_[index];
+        }
+
+        const T& operator[](size_t index) const noexcept
+        {
+            return items_[index];
+        }
+
+        bool operator==(const Vector& that) const
+        {
+            return size_ == that.size_ && equal_items(items_, that.items_, size_);
+        }
+
+        // parallel counterparts of bulk operations - ranges below policy.serial_threshold are processed serially
+
+        // parallel copy assignment
+        void assign(const Vector& source, const Parallel& policy)
+        {
+            if (this == &source)
+                return;
+
+            if (source.size_ > capacity_)
+            {
+                Vector temp(source.size_, alloc_, reserve_tag{});
+                temp.parallel_construct_from(source.items_, temp.items_, source.size_, policy);
+                temp.size_ = source.size_;
+                swap(temp);
+            }
+            else
+            {
+                const size_t common_size = std::min(size_, source.size_);
+                Detail::parallel_for(common_size, sizeof(T), policy, [&](size_t first, size_t last) {
+                    std::copy(source.items_ + first, source.items_ + last, items_ + first);
+                });
+
+                if (source.size_ > size_)
+                    parallel_construct_from(source.items_ + size_, items_ + size_, source.size_ - size_, policy);
+                else
+                    destroy(items_ + source.size_, items_ + size_);
+
+                size_ = source.size_;
+            }
+
+            trace(VectorEvent::copy_assigned);
+        }
+
+        // parallel operator==
+        bool equal(const Vector& that, const Parallel& policy) const
+        {
+            if (size_ != that.size_)
+                return false;
+
+            // chunks are compared in blocks, so a mismatch found by one thread stops the others
+            constexpr size_t block_size = 64 * 1024;
+            std::atomic<bool> mismatch{false};
+
+            Detail::parallel_for(size_, sizeof(T), policy, [&](size_t first, size_t last) {
+                for (size_t block = first; block < last && !mismatch.load(std::memory_order_relaxed); block += block_size)
+                {
+                    const size_t count = std::min(block_size, last - block);
+                    if (!equal_items(items_ + block, that.items_ + block, count))
+                        mismatch.store(true, std::memory_order_relaxed);
+                }
+            });
+
+            return !mismatch.load();
+        }
+
+        // assigns value to all items
+        void fill(const T& value)
+        {
+            std::fill(begin(), end(), value);
+        }
+
+        void fill(const T& value, const Parallel& policy)
+        {
+            Detail::parallel_for(size_, sizeof(T), policy, [&](size_t first, size_t last) {
+                std::fill(items_ + first, items_ + last, value);
+            });
+        }
+
+        void clear() noexcept
+        {
+            destroy(begin(), end());
+            size_ = 0;
+        }
+
+        // removes items satisfying pred in a single pass - order of remaining items is kept
+        // and storage is not reallocated; returns number of removed items
+        template <typename Predicate>
+        size_t erase_if(Predicate pred)
+        {
+            T* new_end;
+            if constexpr (is_bulk_copyable)
+            {
+                using Detail::compact_items;
+                new_end = compact_items(items_, items_ + size_, items_, pred, false);
+            }
+            else
+            {
+                new_end = std::remove_if(begin(), end(), pred);
+            }
+
+            const size_t removed = end() - new_end;
+            destroy(new_end, end());
+            size_ -= removed;
+
+            return removed;
+        }
+
+        // appends items satisfying pred to out (which must be another vector)
+        template <typename Predicate>
+        void filter_into(Vector& out, Predicate pred) const
+        {
+            assert(&out != this && "filtering into the source vector");
+
+            if constexpr (is_bulk_copyable)
+            {
+                // selected items of each chunk are packed into spare capacity of out - out grows geometrically
+                // when a chunk may not fit, so a selective predicate doesn't reserve room for the whole source
+                using Detail::compact_items;
+                for (size_t first = 0; first < size_; first += filter_chunk_size)
+                {
+                    const size_t n = std::min(filter_chunk_size, size_ - first);
+                    if (out.capacity_ - out.size_ < n)
+                        out.reserve(std::max(out.size_ + n, out.capacity_ * growth_factor));
+                    out.size_ = compact_items(items_ + first, items_ + first + n, out.items_ + out.size_, pred, true) - out.items_;
+                }
+            }
+            else
+            {
+                for (const T& item : *this)
+                    if (pred(item))
+                        out.push_back(item);
+            }
+        }
+
+        template <typename TItem>
+        void push_back(TItem&& item)
+        {
+            emplace_back(std::forward<TItem>(item));
+        }
+
+        template <typename... TArgs>
+        T& emplace_back(TArgs&&... args)
+        {
+            if (size_ < capacity_)
+            {
+                alloc_traits::construct(alloc_, items_ + size_, std::forward<TArgs>(args)...);
+                return items_[size_++];
+            }
+
+            // new item is created before the old ones are relocated - args may refer to an item of this vector
+            const size_t new_capacity = next_capacity();
+            T* new_items = allocate(new_capacity);
+            try
+            {
+                alloc_traits::construct(alloc_, new_items + size_, std::forward<TArgs>(args)...);
+            }
+            catch (...)
+            {
+                deallocate(new_items, new_capacity);
+                throw;
+            }
+
+            try
+            {
+                relocate_to(new_items);
+            }
+            catch (...)
+            {
+                alloc_traits::destroy(alloc_, new_items + size_);
+                deallocate(new_items, new_capacity);
+                throw;
+            }
+
+            capacity_ = new_capacity;
+            trace(VectorEvent::reallocated);
+            return items_[size_++];
+        }
+
+        // items of sized ranges are added with at most one reallocation - other ranges grow geometrically
+        template <container_compatible_range<T> R>
+        void append_range(R&& range)
+        {
+            if constexpr (is_sized_range<R>)
+            {
+                auto first = std::ranges::begin(range);
+                auto last = std::ranges::end(range);
+                const size_t n = range_size(range, first, last);
+
+                if (size_ + n <= capacity_)
+                {
+                    construct_from(std::move(first), std::move(last), items_ + size_);
+                    size_ += n;
+                    return;
+                }
+
+                // new items are created before the old ones are relocated - range may refer to items of this vector
+                const size_t new_capacity = std::max(size_ + n, capacity_ * growth_factor);
+                T* new_items = allocate(new_capacity);
+                try
+                {
+                    construct_from(std::move(first), std::move(last), new_items + size_);
+                }
+                catch (...)
+                {
+                    deallocate(new_items, new_capacity);
+                    throw;
+                }
+
+                try
+                {
+                    relocate_to(new_items);
+                }
+                catch (...)
+                {
+                    destroy(new_items + size_, new_items + size_ + n);
+                    deallocate(new_items, new_capacity);
+                    throw;
+                }
+
+                capacity_ = new_capacity;
+                size_ += n;
+                trace(VectorEvent::reallocated);
+            }
+            else
+            {
+                for (auto&& item : range)
+                    emplace_back(std::forward<decltype(item)>(item));
+            }
+        }
+
+        // inserts items of range before pos - returns iterator to the first inserted item
+        template <container_compatible_range<T> R>
+        iterator insert_range(const_iterator pos, R&& range)
+        {
+            // items are appended and rotated into place - no temporary copy of the range is needed
+            const size_t offset = pos - cbegin();
+            const size_t old_size = size_;
+
+            append_range(std::forward<R>(range));
+            std::rotate(begin() + offset, begin() + old_size, end());
+
+            return begin() + offset;
+        }
+
+    private:
+        [[no_unique_address]] Allocator alloc_{};
+        size_t size_{};
+        size_t capacity_{};
+        T* items_{};
+
+        struct reserve_tag
+        { };
+
+        // allocates raw storage - items are constructed later in place
+        // when this constructor completes the object is fully constructed, so the destructor
+        // releases storage if a delegating constructor throws
+        Vector(size_t capacity, const Allocator& alloc, reserve_tag)
+            : alloc_{alloc}
+            , capacity_{capacity}
+            , items_{allocate(capacity)}
+        {
+        }
+
+        // number of items is known before iteration
+        template <typename R>
+        static constexpr bool is_sized_range = std::ranges::sized_range<R>
+            || std::sized_sentinel_for<std::ranges::sentinel_t<R>, std::ranges::iterator_t<R>>;
+
+        template <typename R, typename I, typename S>
+        static size_t range_size(R& range, const I& first, const S& last)
+        {
+            if constexpr (std::ranges::sized_range<R>)
+                return std::ranges::size(range);
+            else
+                return last - first;
+        }
+
+        T* allocate(size_t n)
+        {
+            return n == 0 ? nullptr : alloc_traits::allocate(alloc_, n);
+        }
+
+        void deallocate(T* items, size_t n) noexcept
+        {
+            if (items)
+                alloc_traits::deallocate(alloc_, items, n);
+        }
+
+        void destroy(T* first, T* last) noexcept
+        {
+            for (; first != last; ++first)
+                alloc_traits::destroy(alloc_, first);
+        }
+
+        void destroy_and_deallocate() noexcept
+        {
+            destroy(begin(), end());
+            deallocate(items_, capacity_);
+        }
+
+        // value-initializes n items in raw storage - already constructed items are destroyed on exception
+        void construct_n(T* dest, size_t n)
+        {
+            T* current = dest;
+            try
+            {
+                for (; n > 0; --n, ++current)
+                    alloc_traits::construct(alloc_, current);
+            }
+            catch (...)
+            {
+                destroy(dest, current);
+                throw;
+            }
+        }
+
+        // allocator-aware counterpart of std::uninitialized_copy
+        template <typename InputIterator, typename Sentinel>
+        T* construct_from(InputIterator first, Sentinel last, T* dest)
+        {
+            if constexpr (is_bulk_copyable && std::contiguous_iterator<InputIterator>
+                && std::sized_sentinel_for<Sentinel, InputIterator>
+                && std::is_same_v<std::iter_value_t<InputIterator>, T>)
+            {
+                const size_t n = last - first;
+                if (n != 0)
+                    std::memcpy(dest, std::to_address(first), n * sizeof(T));
+                return dest + n;
+            }
+
+            T* current = dest;
+            try
+            {
+                for (; first != last; ++first, ++current)
+                    alloc_traits::construct(alloc_, current, *first);
+            }
+            catch (...)
+            {
+                destroy(dest, current);
+                throw;
+            }
+
+            return current;
+        }
+
+        // constructs n items copied from source in raw storage dest - in parallel for large ranges
+        void parallel_construct_from(const T* source, T* dest, size_t n, const Parallel& policy)
+        {
+            Detail::parallel_for(
+                n, sizeof(T), policy,
+                [&](size_t first, size_t last) { construct_from(source + first, source + last, dest + first); },
+                [&](size_t first, size_t last) { destroy(dest + first, dest + last); });
+        }
+
+        static bool equal_items(const T* a, const T* b, size_t n)
+        {
+            if constexpr (is_trivially_equality_comparable_v<T>)
+            {
+                return n == 0 || std::memcmp(a, b, n * sizeof(T)) == 0;
+            }
+            else
+            {
+                return std::equal(a, a + n, b);
+            }
+        }
+
+        // replaces content with n items from [first, last) - live items are assigned, the rest is constructed in place
+        template <typename InputIterator>
+        void assign_items(InputIterator first, InputIterator last, size_t n)
+        {
+            if (n > capacity_)
+            {
+                T* new_items = allocate(n);
+                try
+                {
+                    construct_from(first, last, new_items);
+                }
+                catch (...)
+                {
+                    deallocate(new_items, n);
+                    throw;
+                }
+
+                destroy_and_deallocate();
+                items_ = new_items;
+                size_ = capacity_ = n;
+                return;
+            }
+
+            if constexpr (is_bulk_copyable && std::contiguous_iterator<InputIterator>
+                && std::is_same_v<std::iter_value_t<InputIterator>, T>)
+            {
+                // assignment and destruction are trivial - whole content is overwritten at once
+                if (n != 0)
+                    std::memcpy(items_, std::to_address(first), n * sizeof(T));
+                size_ = n;
+                return;
+            }
+
+            const size_t common_size = std::min(size_, n);
+            for (size_t i = 0; i < common_size; ++i, ++first)
+                items_[i] = *first;
+
+            if (n > size_)
+                construct_from(first, last, items_ + size_);
+            else
+                destroy(items_ + n, items_ + size_);
+
+            size_ = n;
+        }
+
+        // geometric growth - amortized O(1) push_back
+        size_t next_capacity() const noexcept
+        {
+            return capacity_ == 0 ? 1 : capacity_ * growth_factor;
+        }
+
+        void reallocate(size_t new_capacity)
+        {
+            T* new_items = allocate(new_capacity);
+            try
+            {
+                relocate_to(new_items);
+            }
+            catch (...)
+            {
+                deallocate(new_items, new_capacity);
+                throw;
+            }
+            capacity_ = new_capacity;
+            trace(VectorEvent::reallocated);
+        }
+
+        // moves (or copies if move may throw) live items to new storage, destroys them and releases the old buffer
+        void relocate_to(T* new_items)
+        {
+            if constexpr (is_bulk_relocatable)
+            {
+                // bytes are moved - old items are not destroyed
+                if (size_ != 0)
+                    std::memcpy(static_cast<void*>(new_items), static_cast<const void*>(items_), size_ * sizeof(T));
+                deallocate(items_, capacity_);
+                items_ = new_items;
+                return;
+            }
+            else if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>)
+            {
+                construct_from(std::make_move_iterator(begin()), std::make_move_iterator(end()), new_items);
+            }
+            else
+            {
+                construct_from(begin(), end(), new_items);
+            }
+
+            destroy_and_deallocate();
+            items_ = new_items;
+        }
+
+        void trace(VectorEvent event) const noexcept
+        {
+            Tracing::trace(event, this, size_, capacity_);
+        }
+    };
+
+    namespace pmr
+    {
+        // Vector using memory resource, e.g.:
+        //   std::pmr::monotonic_buffer_resource arena{buffer, sizeof(buffer)};
+        //   ModernCpp::pmr::Vector<int> vec(&arena);
+        template <typename T, typename Tracing = NoTracing>
+        using Vector = ModernCpp::Vector<T, std::pmr::polymorphic_allocator<T>, Tracing>;
+    } // namespace pmr
+} // namespace ModernCpp
+
+#include "vector_bool.hpp" // bit-packed specialization Vector<bool>
+
+#endif // VECTOR_HPP
@@ -0,0 +1,832 @@
+#include "../move-semantics/helpers.hpp"
+#include "concurrent_append_vector.hpp"
+#include "cow_vector.hpp"
+#include "mmap_vector.hpp"
+#include "segmented_vector.hpp"
+#include "small_vector.hpp"
+#include "sorted_index.hpp"
+#include "vector.hpp"
+
+#include <algorithm>
+#include <array>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory_resource>
+#include <mutex>
+#include <numeric>
+#include <random>
+#include <ranges>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+// Benchmarks of ModernCpp::Vector compared with std::vector
+// Results can be saved for comparison between releases:
+//   bench-vector --reporter console --reporter xml::out=bench-vector.xml
+// or with: cmake --build . --target run-bench-vector
+
+using namespace std::literals;
+
+namespace
+{
+    constexpr std::array sizes = {1'000uz, 100'000uz, 1'000'000uz};
+
+    template <typename T>
+    T make_value(size_t i)
+    {
+        if constexpr (std::is_same_v<T, std::string>)
+            return "item number " + std::to_string(i) + " long enough to be allocated on the heap";
+        else
+            return static_cast<T>(i);
+    }
+
+    template <typename Container>
+    Container make_container(size_t n)
+    {
+        Container container;
+        container.reserve(n);
+        for (size_t i = 0; i < n; ++i)
+            container.push_back(make_value<typename Container::value_type>(i));
+        return container;
+    }
+
+    // non-trivial copy - forces item by item path
+    struct Integer
+    {
+        int value;
+
+        Integer(int v = 0)
+            : value{v}
+        {
+        }
+
+        Integer(const Integer& other)
+            : value{other.value}
+        {
+        }
+
+        Integer& operator=(const Integer& other)
+        {
+            value = other.value;
+            return *this;
+        }
+
+        bool operator==(const Integer&) const = default;
+    };
+} // namespace
+
+TEMPLATE_TEST_CASE("Vector vs std::vector", "[Vector]", int, double, std::string)
+{
+    using Vector = ModernCpp::Vector<TestType>;
+    using StdVector = std::vector<TestType>;
+
+    for (const size_t n : sizes)
+    {
+        const std::string suffix = " - " + std::to_string(n) + " items";
+
+        const Vector vec = make_container<Vector>(n);
+        const StdVector std_vec = make_container<StdVector>(n);
+        const Vector vec_copy = vec;
+        const StdVector std_vec_copy = std_vec;
+
+        BENCHMARK("Vector - construction with size" + suffix)
+        {
+            return Vector(n);
+        };
+
+        BENCHMARK("std::vector - construction with size" + suffix)
+        {
+            return StdVector(n);
+        };
+
+        BENCHMARK("Vector - copy" + suffix)
+        {
+            return Vector(vec);
+        };
+
+        BENCHMARK("std::vector - copy" + suffix)
+        {
+            return StdVector(std_vec);
+        };
+
+        BENCHMARK_ADVANCED("Vector - move" + suffix)(Catch::Benchmark::Chronometer meter)
+        {
+            std::vector<Vector> sources(meter.runs(), vec);
+            meter.measure([&](int i) { return Vector(std::move(sources[i])); });
+        };
+
+        BENCHMARK_ADVANCED("std::vector - move" + suffix)(Catch::Benchmark::Chronometer meter)
+        {
+            std::vector<StdVector> sources(meter.runs(), std_vec);
+            meter.measure([&](int i) { return StdVector(std::move(sources[i])); });
+        };
+
+        BENCHMARK("Vector - push_back" + suffix)
+        {
+            Vector result;
+            for (const auto& item : vec)
+                result.push_back(item);
+            return result;
+        };
+
+        BENCHMARK("std::vector - push_back" + suffix)
+        {
+            StdVector result;
+            for (const auto& item : std_vec)
+                result.push_back(item);
+            return result;
+        };
+
+        BENCHMARK("Vector - iteration" + suffix)
+        {
+            size_t checksum = 0;
+            for (const auto& item : vec)
+                checksum += sizeof(item) + (item == TestType{});
+            return checksum;
+        };
+
+        BENCHMARK("std::vector - iteration" + suffix)
+        {
+            size_t checksum = 0;
+            for (const auto& item : std_vec)
+                checksum += sizeof(item) + (item == TestType{});
+            return checksum;
+        };
+
+        BENCHMARK("Vector - indexing" + suffix)
+        {
+            size_t checksum = 0;
+            for (size_t i = 0; i < n; ++i)
+                checksum += (vec[i] == TestType{});
+            return checksum;
+        };
+
+        BENCHMARK("std::vector - indexing" + suffix)
+        {
+            size_t checksum = 0;
+            for (size_t i = 0; i < n; ++i)
+                checksum += (std_vec[i] == TestType{});
+            return checksum;
+        };
+
+        BENCHMARK("Vector - equality" + suffix)
+        {
+            return vec == vec_copy;
+        };
+
+        BENCHMARK("std::vector - equality" + suffix)
+        {
+            return std_vec == std_vec_copy;
+        };
+    }
+}
+
+TEST_CASE("Vector - construction", "[Vector][constructors]")
+{
+    using ModernCpp::Vector;
+    using Helpers::String;
+
+    const std::vector<std::string> words(1'000, "a text long enough to be allocated on the heap");
+
+    BENCHMARK("Vector<std::string> - copy constructor")
+    {
+        Vector<std::string> vec;
+        vec.reserve(words.size());
+        for (const auto& w : words)
+            vec.push_back(w);
+        return Vector<std::string>(vec).size();
+    };
+
+    BENCHMARK("std::vector<std::string> - copy constructor")
+    {
+        std::vector<std::string> vec(words.begin(), words.end());
+        return std::vector<std::string>(vec).size();
+    };
+
+    String::clear_stats();
+    {
+        Vector<String> vec = {"one", "two", "three", "four"};
+        Vector<String> backup = vec;
+        backup.push_back(vec[0]);
+    }
+    String::print_stats("Vector<Helpers::String>");
+}
+
+TEST_CASE("Vector - allocators", "[Vector][allocators]")
+{
+    constexpr int vectors_count = 1'000;
+    constexpr int items_count = 16;
+
+    BENCHMARK("Vector<int> - heap")
+    {
+        size_t total = 0;
+        for (int i = 0; i < vectors_count; ++i)
+        {
+            ModernCpp::Vector<int> vec;
+            for (int j = 0; j < items_count; ++j)
+                vec.push_back(j);
+            total += vec.size();
+        }
+        return total;
+    };
+
+    BENCHMARK("pmr::Vector<int> - monotonic arena")
+    {
+        static std::byte buffer[vectors_count * items_count * 2 * sizeof(int)];
+        std::pmr::monotonic_buffer_resource arena{buffer, sizeof(buffer)};
+
+        size_t total = 0;
+        for (int i = 0; i < vectors_count; ++i)
+        {
+            ModernCpp::pmr::Vector<int> vec(&arena);
+            for (int j = 0; j < items_count; ++j)
+                vec.push_back(j);
+            total += vec.size();
+        }
+        return total;
+    };
+
+    BENCHMARK("pmr::Vector<int> - unsynchronized pool")
+    {
+        std::pmr::unsynchronized_pool_resource pool;
+
+        size_t total = 0;
+        for (int i = 0; i < vectors_count; ++i)
+        {
+            ModernCpp::pmr::Vector<int> vec(&pool);
+            for (int j = 0; j < items_count; ++j)
+                vec.push_back(j);
+            total += vec.size();
+        }
+        return total;
+    };
+}
+
+TEST_CASE("Vector - trivially copyable items", "[Vector][trivial]")
+{
+    using namespace ModernCpp;
+
+    for (const size_t n : {1'000'000uz, 100'000'000uz})
+    {
+        const std::string suffix = " - " + std::to_string(n) + " items";
+
+        Vector<int> ints;
+        ints.reserve(n);
+        Vector<Integer> integers;
+        integers.reserve(n);
+        for (size_t i = 0; i < n; ++i)
+        {
+            ints.push_back(static_cast<int>(i));
+            integers.push_back(static_cast<int>(i));
+        }
+
+        const Vector<int> ints_copy = ints;
+        const Vector<Integer> integers_copy = integers;
+
+        BENCHMARK("Vector<int> - copy (memcpy)" + suffix)
+        {
+            return Vector<int>(ints).size();
+        };
+
+        BENCHMARK("Vector<Integer> - copy (item by item)" + suffix)
+        {
+            return Vector<Integer>(integers).size();
+        };
+
+        BENCHMARK("Vector<int> - operator== (memcmp)" + suffix)
+        {
+            return ints == ints_copy;
+        };
+
+        BENCHMARK("Vector<Integer> - operator== (item by item)" + suffix)
+        {
+            return integers == integers_copy;
+        };
+
+        BENCHMARK("Vector<int> - relocation (memcpy)" + suffix)
+        {
+            Vector<int> vec = ints;
+            vec.reserve(2 * n);
+            return vec.capacity();
+        };
+
+        BENCHMARK("Vector<Integer> - relocation (item by item)" + suffix)
+        {
+            Vector<Integer> vec = integers;
+            vec.reserve(2 * n);
+            return vec.capacity();
+        };
+    }
+}
+
+TEST_CASE("Vector - tracing policy", "[Vector][tracing]")
+{
+    using namespace ModernCpp;
+
+    BENCHMARK("create_vector(1M) - no tracing")
+    {
+        return Vector<int>(1'000'000).size();
+    };
+
+    BENCHMARK("create_vector(1M) - buffered tracing")
+    {
+        return Vector<int, std::allocator<int>, BufferedTracing<>>(1'000'000).size();
+    };
+}
+
+TEST_CASE("SmallVector", "[SmallVector]")
+{
+    constexpr int vectors_count = 1'000;
+
+    for (const int n : {8, 64})
+    {
+        BENCHMARK("Vector<int> - " + std::to_string(n) + " items")
+        {
+            size_t total = 0;
+            for (int i = 0; i < vectors_count; ++i)
+            {
+                ModernCpp::Vector<int> vec;
+                for (int j = 0; j < n; ++j)
+                    vec.push_back(j);
+                total += vec.size();
+            }
+            return total;
+        };
+
+        BENCHMARK("SmallVector<int, 16> - " + std::to_string(n) + " items")
+        {
+            size_t total = 0;
+            for (int i = 0; i < vectors_count; ++i)
+            {
+                ModernCpp::SmallVector<int, 16> vec;
+                for (int j = 0; j < n; ++j)
+                    vec.push_back(j);
+                total += vec.size();
+            }
+            return total;
+        };
+
+        BENCHMARK("std::vector<int> - " + std::to_string(n) + " items")
+        {
+            size_t total = 0;
+            for (int i = 0; i < vectors_count; ++i)
+            {
+                std::vector<int> vec;
+                for (int j = 0; j < n; ++j)
+                    vec.push_back(j);
+                total += vec.size();
+            }
+            return total;
+        };
+    }
+}
+
+TEST_CASE("Vector - push_back", "[Vector][push_back]")
+{
+    using namespace ModernCpp;
+
+    for (const int n : {1'000, 10'000})
+    {
+        BENCHMARK("Vector<int>::push_back x " + std::to_string(n))
+        {
+            Vector<int> vec;
+            for (int i = 0; i < n; ++i)
+                vec.push_back(i);
+            return vec.size();
+        };
+
+        BENCHMARK("std::vector<int>::push_back x " + std::to_string(n))
+        {
+            std::vector<int> vec;
+            for (int i = 0; i < n; ++i)
+                vec.push_back(i);
+            return vec.size();
+        };
+    }
+}
+
+TEST_CASE("Vector - construction from range", "[Vector][ranges]")
+{
+    using namespace ModernCpp;
+
+    constexpr int n = 100'000;
+
+    BENCHMARK("push_back in loop - sized range")
+    {
+        Vector<int> vec;
+        for (int x : std::views::iota(0, n))
+            vec.push_back(x);
+        return vec.size();
+    };
+
+    BENCHMARK("from_range - sized range")
+    {
+        return Vector<int>(from_range, std::views::iota(0, n)).size();
+    };
+
+    const std::vector<int> source(n, 42);
+
+    BENCHMARK("from_range - contiguous range")
+    {
+        return Vector<int>(from_range, source).size();
+    };
+
+    BENCHMARK("from_range - unsized pipeline")
+    {
+        auto squares = std::views::iota(0)
+            | std::views::filter([](int x) { return x % 2 == 0; })
+            | std::views::transform([](int x) { return x * x; })
+            | std::views::take(n);
+        return Vector<int>(from_range, squares).size();
+    };
+}
+
+TEST_CASE("Vector - parallel bulk operations", "[Vector][parallel]")
+{
+    using ModernCpp::Vector, ModernCpp::Parallel;
+
+    constexpr size_t n = 32 * 1024 * 1024; // 128 MiB of ints
+
+    const Vector<int> source = make_container<Vector<int>>(n);
+    const Vector<int> source_copy = source;
+    Vector<int> target(n);
+
+    for (const size_t threads : {1, 2, 4, 8})
+    {
+        const Parallel policy{.threads = threads};
+        const std::string suffix = " - " + std::to_string(threads) + " thread(s)";
+
+        BENCHMARK("copy constructor" + suffix)
+        {
+            return Vector<int>(source, policy);
+        };
+
+        BENCHMARK("assign" + suffix)
+        {
+            target.assign(source, policy);
+            return target.size();
+        };
+
+        BENCHMARK("equal" + suffix)
+        {
+            return source.equal(source_copy, policy);
+        };
+
+        BENCHMARK("fill" + suffix)
+        {
+            target.fill(42, policy);
+            return target.size();
+        };
+    }
+}
+
+namespace
+{
+    // appends n items in batches of 64 and prints percentiles of batch latency - spikes show reallocations
+    template <typename Container>
+    void report_append_latency(const std::string& name, size_t n)
+    {
+        using namespace std::chrono;
+
+        constexpr size_t batch_size = 64;
+
+        std::vector<nanoseconds> latencies;
+        latencies.reserve(n / batch_size);
+
+        Container container;
+        for (size_t i = 0; i < n; i += batch_size)
+        {
+            const auto start = steady_clock::now();
+            for (size_t j = i; j < i + batch_size; ++j)
+                container.push_back(static_cast<int>(j));
+            latencies.push_back(duration_cast<nanoseconds>(steady_clock::now() - start));
+        }
+
+        std::ranges::sort(latencies);
+        const auto percentile = [&](double p) { return latencies[static_cast<size_t>(p * (latencies.size() - 1))].count(); };
+
+        std::cout << std::left << std::setw(24) << name
+                  << " p50: " << std::setw(8) << percentile(0.5)
+                  << " p99: " << std::setw(8) << percentile(0.99)
+                  << " p99.9: " << std::setw(8) << percentile(0.999)
+                  << " p99.99: " << std::setw(10) << percentile(0.9999)
+                  << " max: " << latencies.back().count() << " ns per " << batch_size << " items\n";
+    }
+} // namespace
+
+TEST_CASE("SegmentedVector - append latency", "[SegmentedVector]")
+{
+    constexpr size_t n = 16 * 1024 * 1024;
+
+    report_append_latency<ModernCpp::SegmentedVector<int>>("SegmentedVector<int>", n);
+    report_append_latency<ModernCpp::Vector<int>>("Vector<int>", n);
+    report_append_latency<std::vector<int>>("std::vector<int>", n);
+
+    BENCHMARK("SegmentedVector<int>::push_back x 1M")
+    {
+        ModernCpp::SegmentedVector<int> vec;
+        for (int i = 0; i < 1'000'000; ++i)
+            vec.push_back(i);
+        return vec.size();
+    };
+
+    BENCHMARK("Vector<int>::push_back x 1M")
+    {
+        ModernCpp::Vector<int> vec;
+        for (int i = 0; i < 1'000'000; ++i)
+            vec.push_back(i);
+        return vec.size();
+    };
+}
+
+namespace
+{
+    // drops clean pages of file from page cache - next access reads from disk (no root required)
+    void evict_page_cache(const std::filesystem::path& path)
+    {
+        const int fd = ::open(path.c_str(), O_RDONLY);
+        ::posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+        ::close(fd);
+    }
+} // namespace
+
+TEST_CASE("MmapVector - cold open", "[MmapVector]")
+{
+    using namespace ModernCpp;
+
+    constexpr size_t n = 16 * 1024 * 1024; // 128 MiB of doubles
+    const auto path = std::filesystem::temp_directory_path() / "mmap_vector_benchmark.bin";
+
+    {
+        MmapVector<double> data(path);
+        data.resize(n);
+        std::iota(data.begin(), data.end(), 0.0);
+        data.sync();
+    }
+
+    BENCHMARK_ADVANCED("MmapVector<const double> - open")(Catch::Benchmark::Chronometer meter)
+    {
+        evict_page_cache(path);
+        meter.measure([&] {
+            return MmapVector<const double>(path).size();
+        });
+    };
+
+    BENCHMARK_ADVANCED("MmapVector<const double> - open & sum")(Catch::Benchmark::Chronometer meter)
+    {
+        evict_page_cache(path);
+        meter.measure([&] {
+            const MmapVector<const double> data(path);
+            return std::accumulate(data.begin(), data.end(), 0.0);
+        });
+    };
+
+    BENCHMARK_ADVANCED("Vector<double> - read & sum")(Catch::Benchmark::Chronometer meter)
+    {
+        evict_page_cache(path);
+        meter.measure([&] {
+            std::ifstream in{path, std::ios::binary};
+            Vector<double> data(std::filesystem::file_size(path) / sizeof(double));
+            in.read(reinterpret_cast<char*>(data.begin()), data.size() * sizeof(double));
+            return std::accumulate(data.begin(), data.end(), 0.0);
+        });
+    };
+
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("CowVector - snapshots", "[CowVector]")
+{
+    using namespace ModernCpp;
+
+    constexpr size_t n = 1'000'000;
+
+    const Vector<int> vec = make_container<Vector<int>>(n);
+
+    CowVector<int> cow_vec; // built like a typical snapshot source
+    for (const int item : vec)
+        cow_vec.push_back(item);
+    REQUIRE(CowVector<int>(cow_vec).is_shared());
+
+    BENCHMARK("Vector<int> - snapshot")
+    {
+        return Vector<int>(vec).size();
+    };
+
+    BENCHMARK("CowVector<int> - snapshot")
+    {
+        return CowVector<int>(cow_vec).size();
+    };
+
+    BENCHMARK("CowVector<int> - snapshot & first write")
+    {
+        CowVector<int> snapshot = cow_vec;
+        snapshot[0] = 42; // detaches
+        return snapshot.size();
+    };
+
+    CowVector<int> detached = cow_vec;
+    detached[0] = 42;
+
+    BENCHMARK("CowVector<int> - write to detached vector")
+    {
+        for (size_t i = 0; i < 1'000; ++i)
+            detached[i] = static_cast<int>(i);
+        return detached.size();
+    };
+
+    Vector<int> plain = vec;
+
+    BENCHMARK("Vector<int> - write")
+    {
+        for (size_t i = 0; i < 1'000; ++i)
+            plain[i] = static_cast<int>(i);
+        return plain.size();
+    };
+}
+
+TEST_CASE("ConcurrentAppendVector - producers", "[ConcurrentAppendVector]")
+{
+    using namespace ModernCpp;
+
+    constexpr size_t n = 4 * 1024 * 1024;
+
+    // each of producers_count threads appends n / producers_count items
+    const auto run_producers = [](size_t producers_count, auto append) {
+        std::vector<std::jthread> producers;
+        for (size_t producer = 0; producer < producers_count; ++producer)
+        {
+            producers.emplace_back([=] {
+                for (size_t i = 0; i < n / producers_count; ++i)
+                    append(static_cast<int>(i));
+            });
+        }
+    };
+
+    for (const size_t producers_count : {1, 2, 4, 8})
+    {
+        const std::string suffix = " - " + std::to_string(producers_count) + " producer(s)";
+
+        BENCHMARK("ConcurrentAppendVector<int>::push_back" + suffix)
+        {
+            ConcurrentAppendVector<int> vec;
+            run_producers(producers_count, [&vec](int x) { vec.push_back(x); });
+            return vec.size();
+        };
+
+        BENCHMARK("Vector<int>::push_back with mutex" + suffix)
+        {
+            Vector<int> vec;
+            std::mutex mtx;
+            run_producers(producers_count, [&](int x) {
+                std::lock_guard lk{mtx};
+                vec.push_back(x);
+            });
+            return vec.size();
+        };
+    }
+}
+
+TEST_CASE("Vector<bool> - bit-packed vs byte layout", "[Vector][bool]")
+{
+    using namespace ModernCpp;
+
+    constexpr size_t n = 64 * 1024 * 1024;
+
+    // every 7th flag is set
+    Vector<bool> bits(n), other_bits(n, true);
+    std::vector<bool> std_bits(n), other_std_bits(n, true);
+    Vector<uint8_t> bytes(n), other_bytes(n);
+    other_bytes.fill(1);
+    for (size_t i = 0; i < n; i += 7)
+    {
+        bits[i] = true;
+        std_bits[i] = true;
+        bytes[i] = 1;
+    }
+
+    BENCHMARK("Vector<bool> - count")
+    {
+        return bits.count();
+    };
+
+    BENCHMARK("std::vector<bool> - std::count")
+    {
+        return std::count(std_bits.begin(), std_bits.end(), true);
+    };
+
+    BENCHMARK("Vector<uint8_t> - std::count")
+    {
+        return std::count(bytes.begin(), bytes.end(), uint8_t{1});
+    };
+
+    BENCHMARK("Vector<bool> - &=")
+    {
+        bits &= other_bits;
+        return bits.size();
+    };
+
+    BENCHMARK("std::vector<bool> - loop &=")
+    {
+        for (size_t i = 0; i < n; ++i)
+            std_bits[i] = std_bits[i] && other_std_bits[i];
+        return std_bits.size();
+    };
+
+    BENCHMARK("Vector<uint8_t> - loop &=")
+    {
+        for (size_t i = 0; i < n; ++i)
+            bytes[i] &= other_bytes[i];
+        return bytes.size();
+    };
+
+    BENCHMARK("Vector<bool> - find_first/find_next")
+    {
+        size_t found = 0;
+        for (size_t i = bits.find_first(); i != Vector<bool>::npos; i = bits.find_next(i))
+            ++found;
+        return found;
+    };
+
+    BENCHMARK("std::vector<bool> - scan for set flags")
+    {
+        size_t found = 0;
+        for (size_t i = 0; i < n; ++i)
+            found += std_bits[i];
+        return found;
+    };
+}
+
+namespace
+{
+    // random lookups in n sorted keys (even numbers) - half of the queries are hits
+    void benchmark_lookups(size_t n)
+    {
+        using namespace ModernCpp;
+
+        constexpr size_t queries_count = 64 * 1024;
+
+        Vector<uint32_t> keys(n);
+        for (size_t i = 0; i < n; ++i)
+            keys[i] = static_cast<uint32_t>(2 * i);
+
+        const SortedIndex index(keys);
+
+        std::mt19937 rnd{42};
+        std::uniform_int_distribution<uint32_t> distribution(0, static_cast<uint32_t>(2 * n - 1));
+        std::vector<uint32_t> queries(queries_count);
+        std::ranges::generate(queries, [&] { return distribution(rnd); });
+        std::vector<const uint32_t*> results(queries_count);
+
+        const std::string suffix = " - " + std::to_string(n) + " keys x 64K queries";
+
+        BENCHMARK("std::ranges::lower_bound" + suffix)
+        {
+            size_t found = 0;
+            for (const uint32_t query : queries)
+            {
+                const auto item = std::ranges::lower_bound(keys, query);
+                found += item != keys.end() && *item == query;
+            }
+            return found;
+        };
+
+        BENCHMARK("SortedIndex::contains" + suffix)
+        {
+            size_t found = 0;
+            for (const uint32_t query : queries)
+                found += index.contains(query);
+            return found;
+        };
+
+        BENCHMARK("SortedIndex::lower_bound (batch)" + suffix)
+        {
+            index.lower_bound(queries, results);
+            size_t found = 0;
+            for (size_t i = 0; i < queries_count; ++i)
+                found += results[i] && *results[i] == queries[i];
+            return found;
+        };
+    }
+} // namespace
+
+TEST_CASE("SortedIndex - lookups", "[SortedIndex]")
+{
+    for (const size_t n : {1uz << 10, 1uz << 16, 1uz << 20, 1uz << 24, 1uz << 27})
+        benchmark_lookups(n);
+}
+
+// needs ~12 GB of memory (keys, sorted copy & index) - run explicitly with: bench-vector "[SortedIndex][huge]"
+TEST_CASE("SortedIndex - lookups in 1G keys", "[SortedIndex][huge][.]")
+{
+    benchmark_lookups(1uz << 30);
+}
@@ -0,0 +1,483 @@
+#ifndef VECTOR_BOOL_HPP
+#define VECTOR_BOOL_HPP
+
+// included at the end of vector.hpp - the specialization must be visible wherever Vector is used
+
+#include <algorithm>
+#include <bit>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+
+namespace ModernCpp
+{
+    // Bit-packed Vector<bool> - 64 flags per word
+    // - items are accessed through proxy references
+    // - count, find & bitwise operations process whole words
+    // - bits of the last word past size() are always zero
+    template <typename Allocator, typename Tracing>
+    class Vector<bool, Allocator, Tracing>
+    {
+    public:
+        using Word = uint64_t;
+        static constexpr size_t bits_per_word = 64;
+
+    private:
+        using WordAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Word>;
+
+        template <bool IsConst>
+        class Iterator;
+
+    public:
+        // proxy for a single bit
+        class reference
+        {
+        public:
+            reference(Word* word, Word mask) noexcept
+                : word_{word}
+                , mask_{mask}
+            {
+            }
+
+            reference(const reference&) noexcept = default;
+
+            // assignment of a value (not rebinding) - const, so iterators model std::indirectly_writable
+            const reference& operator=(bool value) const noexcept
+            {
+                if (value)
+                    *word_ |= mask_;
+                else
+                    *word_ &= ~mask_;
+                return *this;
+            }
+
+            const reference& operator=(const reference& other) const noexcept
+            {
+                return *this = static_cast<bool>(other);
+            }
+
+            reference& operator=(const reference& other) noexcept
+            {
+                std::as_const(*this) = static_cast<bool>(other);
+                return *this;
+            }
+
+            operator bool() const noexcept
+            {
+                return (*word_ & mask_) != 0;
+            }
+
+            void flip() const noexcept
+            {
+                *word_ ^= mask_;
+            }
+
+            friend void swap(reference a, reference b) noexcept
+            {
+                const bool temp = a;
+                a = static_cast<bool>(b);
+                b = temp;
+            }
+
+        private:
+            Word* word_;
+            Word mask_;
+        };
+
+        using value_type = bool;
+        using allocator_type = Allocator;
+        using const_reference = bool;
+        using iterator = Iterator<false>;
+        using const_iterator = Iterator<true>;
+
+        // returned by find_first & find_next when there is no set bit
+        static constexpr size_t npos = static_cast<size_t>(-1);
+
+        Vector() noexcept(noexcept(Allocator())) = default;
+
+        explicit Vector(const Allocator& alloc) noexcept
+            : words_{WordAllocator(alloc)}
+        {
+        }
+
+        explicit Vector(size_t size, bool value = false, const Allocator& alloc = Allocator())
+            : words_(word_count(size), WordAllocator(alloc))
+            , size_{size}
+        {
+            if (value)
+                fill(true);
+        }
+
+        Vector(std::initializer_list<bool> items, const Allocator& alloc = Allocator())
+            : Vector(items.size(), false, alloc)
+        {
+            size_t index = 0;
+            for (const bool item : items)
+                set(index++, item);
+        }
+
+        allocator_type get_allocator() const noexcept
+        {
+            return allocator_type(words_.get_allocator());
+        }
+
+        void swap(Vector& that) noexcept
+        {
+            words_.swap(that.words_);
+            std::swap(size_, that.size_);
+        }
+
+        size_t size() const noexcept
+        {
+            return size_;
+        }
+
+        size_t capacity() const noexcept
+        {
+            return words_.capacity() * bits_per_word;
+        }
+
+        bool empty() const noexcept
+        {
+            return size_ == 0;
+        }
+
+        void reserve(size_t new_capacity)
+        {
+            words_.reserve(word_count(new_capacity));
+        }
+
+        void shrink_to_fit()
+        {
+            words_.shrink_to_fit();
+        }
+
+        void clear() noexcept
+        {
+            words_.clear();
+            size_ = 0;
+        }
+
+        // words holding the bits - bit i is stored in words()[i / 64] at position i % 64
+        const Word* words() const noexcept
+        {
+            return words_.begin();
+        }
+
+        iterator begin() noexcept
+        {
+            return iterator{words_.begin(), 0};
+        }
+
+        iterator end() noexcept
+        {
+            return iterator{words_.begin(), size_};
+        }
+
+        const_iterator begin() const noexcept
+        {
+            return const_iterator{words_.begin(), 0};
+        }
+
+        const_iterator end() const noexcept
+        {
+            return const_iterator{words_.begin(), size_};
+        }
+
+        const_iterator cbegin() const noexcept
+        {
+            return begin();
+        }
+
+        const_iterator cend() const noexcept
+        {
+            return end();
+        }
+
+        reference operator[](size_t index) noexcept
+        {
+            return reference{&words_[index / bits_per_word], bit_mask(index)};
+        }
+
+        bool operator[](size_t index) const noexcept
+        {
+            return (words_[index / bits_per_word] & bit_mask(index)) != 0;
+        }
+
+        void set(size_t index, bool value = true) noexcept
+        {
+            (*this)[index] = value;
+        }
+
+        bool operator==(const Vector& that) const
+        {
+            return size_ == that.size_ && words_ == that.words_;
+        }
+
+        void push_back(bool value)
+        {
+            if (size_ % bits_per_word == 0)
+                words_.push_back(Word{value});
+            else
+                set(size_, value);
+            ++size_;
+        }
+
+        void fill(bool value) noexcept
+        {
+            std::fill(words_.begin(), words_.end(), value ? ~Word{0} : Word{0});
+            clear_unused_bits();
+        }
+
+        // number of set bits
+        size_t count() const noexcept
+        {
+            size_t result = 0;
+            for (const Word word : words_)
+                result += std::popcount(word);
+            return result;
+        }
+
+        bool any() const noexcept
+        {
+            return std::ranges::any_of(words_, [](Word word) { return word != 0; });
+        }
+
+        size_t find_first() const noexcept
+        {
+            return find_from(0);
+        }
+
+        // index of the first set bit after pos
+        size_t find_next(size_t pos) const noexcept
+        {
+            return pos + 1 < size_ ? find_from(pos + 1) : npos;
+        }
+
+        void flip() noexcept
+        {
+            for (Word& word : words_)
+                word = ~word;
+            clear_unused_bits();
+        }
+
+        Vector& operator&=(const Vector& that)
+        {
+            check_size(that);
+            for (size_t i = 0; i < words_.size(); ++i)
+                words_[i] &= that.words_[i];
+            return *this;
+        }
+
+        Vector& operator|=(const Vector& that)
+        {
+            check_size(that);
+            for (size_t i = 0; i < words_.size(); ++i)
+                words_[i] |= that.words_[i];
+            return *this;
+        }
+
+        Vector& operator^=(const Vector& that)
+        {
+            check_size(that);
+            for (size_t i = 0; i < words_.size(); ++i)
+                words_[i] ^= that.words_[i];
+            return *this;
+        }
+
+        friend Vector operator&(Vector a, const Vector& b)
+        {
+            a &= b;
+            return a;
+        }
+
+        friend Vector operator|(Vector a, const Vector& b)
+        {
+            a |= b;
+            return a;
+        }
+
+        friend Vector operator^(Vector a, const Vector& b)
+        {
+            a ^= b;
+            return a;
+        }
+
+        friend Vector operator~(Vector a)
+        {
+            a.flip();
+            return a;
+        }
+
+    private:
+        Vector<Word, WordAllocator, Tracing> words_; // one word for every (started) 64 bits
+        size_t size_{};
+
+        static constexpr size_t word_count(size_t bits) noexcept
+        {
+            return (bits + bits_per_word - 1) / bits_per_word;
+        }
+
+        static constexpr Word bit_mask(size_t index) noexcept
+        {
+            return Word{1} << (index % bits_per_word);
+        }
+
+        void clear_unused_bits() noexcept
+        {
+            if (size_ % bits_per_word != 0)
+                words_[words_.size() - 1] &= bit_mask(size_) - 1;
+        }
+
+        void check_size(const Vector& that) const
+        {
+            if (size_ != that.size_)
+                throw std::invalid_argument{"Vector sizes do not match"};
+        }
+
+        // index of the first set bit at or after pos
+        size_t find_from(size_t pos) const noexcept
+        {
+            size_t index = pos / bits_per_word;
+            if (index >= words_.size())
+                return npos;
+
+            Word word = words_[index] & (~Word{0} << (pos % bits_per_word));
+            while (word == 0)
+            {
+                if (++index == words_.size())
+                    return npos;
+                word = words_[index];
+            }
+
+            return index * bits_per_word + std::countr_zero(word);
+        }
+    };
+
+    // random access iterator over bits
+    template <typename Allocator, typename Tracing>
+    template <bool IsConst>
+    class Vector<bool, Allocator, Tracing>::Iterator
+    {
+        using WordPointer = std::conditional_t<IsConst, const Word*, Word*>;
+
+    public:
+        using iterator_concept = std::random_access_iterator_tag;
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = bool;
+        using difference_type = std::ptrdiff_t;
+        using reference = std::conditional_t<IsConst, bool, typename Vector::reference>;
+        using pointer = void;
+
+        Iterator() noexcept = default;
+
+        Iterator(WordPointer words, size_t index) noexcept
+            : words_{words}
+            , index_{index}
+        {
+        }
+
+        // iterator -> const_iterator
+        template <bool IsOtherConst>
+            requires(IsConst && !IsOtherConst)
+        Iterator(const Iterator<IsOtherConst>& other) noexcept
+            : words_{other.words_}
+            , index_{other.index_}
+        {
+        }
+
+        reference operator*() const noexcept
+        {
+            if constexpr (IsConst)
+                return (words_[index_ / bits_per_word] & bit_mask(index_)) != 0;
+            else
+                return reference{words_ + index_ / bits_per_word, bit_mask(index_)};
+        }
+
+        reference operator[](difference_type n) const noexcept
+        {
+            return *(*this + n);
+        }
+
+        Iterator& operator++() noexcept
+        {
+            ++index_;
+            return *this;
+        }
+
+        Iterator operator++(int) noexcept
+        {
+            Iterator temp = *this;
+            ++index_;
+            return temp;
+        }
+
+        Iterator& operator--() noexcept
+        {
+            --index_;
+            return *this;
+        }
+
+        Iterator operator--(int) noexcept
+        {
+            Iterator temp = *this;
+            --index_;
+            return temp;
+        }
+
+        Iterator& operator+=(difference_type n) noexcept
+        {
+            index_ += n;
+            return *this;
+        }
+
+        Iterator& operator-=(difference_type n) noexcept
+        {
+            index_ -= n;
+            return *this;
+        }
+
+        friend Iterator operator+(Iterator it, difference_type n) noexcept
+        {
+            return it += n;
+        }
+
+        friend Iterator operator+(difference_type n, Iterator it) noexcept
+        {
+            return it += n;
+        }
+
+        friend Iterator operator-(Iterator it, difference_type n) noexcept
+        {
+            return it -= n;
+        }
+
+        friend difference_type operator-(const Iterator& a, const Iterator& b) noexcept
+        {
+            return static_cast<difference_type>(a.index_) - static_cast<difference_type>(b.index_);
+        }
+
+        friend bool operator==(const Iterator& a, const Iterator& b) noexcept
+        {
+            return a.index_ == b.index_;
+        }
+
+        friend auto operator<=>(const Iterator& a, const Iterator& b) noexcept
+        {
+            return a.index_ <=> b.index_;
+        }
+
+    private:
+        template <bool>
+        friend class Iterator;
+
+        WordPointer words_{};
+        size_t index_{};
+    };
+} // namespace ModernCpp
+
+#endif // VECTOR_BOOL_HPP
@@ -0,0 +1,80 @@
+#ifndef VECTOR_PARALLEL_HPP
+#define VECTOR_PARALLEL_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace ModernCpp
+{
+    // execution policy for bulk operations on large vectors
+    struct Parallel
+    {
+        // number of threads (including calling thread) used for bulk operation
+        size_t threads = std::max(1u, std::thread::hardware_concurrency());
+
+        // ranges smaller than threshold (in bytes) are processed serially by calling thread
+        size_t serial_threshold = 4 * 1024 * 1024;
+    };
+
+    namespace Detail
+    {
+        // Splits [0, n) into contiguous chunks processed by policy.threads threads - the last chunk
+        // is processed by the calling thread. If any chunk throws, undo(first, last) is called
+        // for every chunk that completed and the first exception is rethrown.
+        template <typename Action, typename Undo>
+        void parallel_for(size_t n, size_t item_size, const Parallel& policy, Action action, Undo undo)
+        {
+            const size_t chunks = (n == 0 || n * item_size < policy.serial_threshold) ? 1 : std::clamp<size_t>(policy.threads, 1, n);
+
+            if (chunks == 1)
+            {
+                action(size_t{0}, n);
+                return;
+            }
+
+            std::vector<std::exception_ptr> errors(chunks);
+            const auto chunk_begin = [=](size_t chunk) { return n / chunks * chunk + std::min(chunk, n % chunks); };
+
+            const auto run_chunk = [&](size_t chunk) {
+                try
+                {
+                    action(chunk_begin(chunk), chunk_begin(chunk + 1));
+                }
+                catch (...)
+                {
+                    errors[chunk] = std::current_exception();
+                }
+            };
+
+            {
+                std::vector<std::jthread> workers;
+                workers.reserve(chunks - 1);
+                for (size_t chunk = 0; chunk < chunks - 1; ++chunk)
+                    workers.emplace_back(run_chunk, chunk);
+
+                run_chunk(chunks - 1);
+            } // workers are joined
+
+            const auto first_error = std::ranges::find_if(errors, [](const auto& e) { return e != nullptr; });
+            if (first_error == errors.end())
+                return;
+
+            for (size_t chunk = 0; chunk < chunks; ++chunk)
+                if (!errors[chunk])
+                    undo(chunk_begin(chunk), chunk_begin(chunk + 1));
+
+            std::rethrow_exception(*first_error);
+        }
+
+        template <typename Action>
+        void parallel_for(size_t n, size_t item_size, const Parallel& policy, Action action)
+        {
+            parallel_for(n, item_size, policy, std::move(action), [](size_t, size_t) {});
+        }
+    } // namespace Detail
+} // namespace ModernCpp
+
+#endif // VECTOR_PARALLEL_HPP
@@ -1,223 +1,33 @@
+#include "../move-semantics/helpers.hpp"
+#include "concurrent_append_vector.hpp"
+#include "cow_vector.hpp"
+#include "mmap_vector.hpp"
+#include "segmented_vector.hpp"
+#include "small_vector.hpp"
+#include "sorted_index.hpp"
+#include "vector.hpp"
+
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <catch2/catch_template_test_macros.hpp>
 #include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
 #include <iostream>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <numeric>
 #include <ranges>
 #include <string>
 #include <string_view>
+#include <thread>
 #include <vector>
 
 using namespace std::literals;
 
-namespace ModernCpp
-{
-    template <typename T>
-    class Vector
-    {
-    public:
-        using iterator = T*;
-        using const_iterator = const T*;
-
-        explicit Vector(size_t size)
-            : size_{size}
-        {
-            items_ = new T[size_]{};
-            print("Vector constructed");
-        }
-
-        Vector(std::initializer_list<T> items)
-            : size_{items.size()}
-            , items_{new T[size_]}
-        {
-            std::ranges::copy(items, items_);
-            print("Vector constructed");
-        }
-
-        // copy constructor
-        Vector(const Vector& source)
-            : size_{source.size()}
-            , items_{new T[size_]}
-        {
-            std::ranges::copy(source, items_);
-            print("Vector copy constructor");
-        }
-
-        // copy assignment
-        Vector& operator=(const Vector& source)
-        {
-            if (this != &source) // avoiding self assignment
-            {
-                delete[] items_;
-
-                size_ = source.size_;
-                items_ = new T[size_];
-                std::ranges::copy(source, items_);
-            }
-
-            // Vector temp(source); // cc
-            // swap(temp);
-            print("Vector - copy assignment");
-
-            return *this;
-        }
-
-		// move constructor
-        Vector(Vector&& source) noexcept
-            : items_{source.items_}
-            , size_{source.size_}
-        {
-            source.items_ = nullptr;
-            source.size_ = 0;
-
-            print("Vector move constructor");
-        }
-
-        // move assignment
-        Vector& operator=(Vector&& source) noexcept
-        {
-            if (this != &source) // avoiding self assignment
-            {
-                delete[] items_;
-
-                size_ = source.size_;
-                items_ = source.items_;
-
-                source.size_ = 0;
-                source.items_ = nullptr;
-            }
-
-            print("Vector - move assignment");
-
-            return *this;
-        }
-
-        ~Vector() noexcept
-        {
-            print("Vector - destructor");
-            delete[] items_;
-        }
-
-        void swap(Vector& that) noexcept
-        {
-            std::swap(this->size_, that.size_);
-            std::swap(this->items_, that.items_);
-        }
-
-        size_t size() const noexcept
-        {
-            return size_;
-        }
-
-        iterator begin() noexcept
-        {
-            return items_;
-        }
-
-        iterator end() noexcept
-        {
-            return items_ + size_;
-        }
-
-        const_iterator begin() const noexcept
-        {
-            return items_;
-        }
-
-        const_iterator end() const noexcept
-        {
-            return items_ + size_;
-        }
-
-        const_iterator cbegin() const noexcept
-        {
-            return items_;
-        }
-
-        const_iterator cend() const noexcept
-        {
-            return items_ + size_;
-        }
-
-        T& operator[](size_t index) noexcept
-        {
-            return items_[index];
-        }
-
-        const T& operator[](size_t index) const noexcept
-        {
-            return items_[index];
-        }
-
-        bool operator==(const Vector& that) const
-        {
-            return std::ranges::equal(*this, that);
-        }
-
-		// void push_back(const T& item)
-		// {			
-		// 	T* new_items = new T[size() + 1];
-		// 	new_items[size()] = item;
-		// 	std::ranges::move(*this, new_items);
-
-		// 	delete[] items_;
-		// 	items_ = new_items;
-		// 	++size_;
-		// }
-
-		// void push_back(T&& item)
-		// {
-		// 	T* new_items = new T[size() + 1];
-		// 	new_items[size()] = std::move(item);
-		// 	std::ranges::move(*this, new_items);
-
-		// 	delete[] items_;
-		// 	items_ = new_items;
-		// 	++size_;
-		// }
-
-		template <typename TItem>
-		void push_back(TItem&& item)
-		{			
-			T* new_items = new T[size() + 1];
-			new_items[size()] = std::forward<TItem>(item);
-
-			if constexpr(std::is_nothrow_constructible_v<T>)
-			{
-				std::ranges::move(*this, new_items);
-			}
-			else
-			{
-				std::ranges::copy(*this, new_items);
-			}
-
-			delete[] items_;
-			items_ = new_items;
-			++size_;
-		}
-
-    private:
-        size_t size_;
-        T* items_;
-
-        void print(std::string_view desc) const
-        {
-            std::cout << desc << ": [ ";
-
-            if (items_)
-            {
-                for (const auto& item : *this)
-                {
-                    std::cout << item << " ";
-                }
-            }
-			else
-				std::cout << "after move ";
-            std::cout << "]\n";
-        }
-    };
-} // namespace ModernCpp
-
 namespace rng = std::ranges;
 
 void print(const auto& container, std::string_view desc = "data")
@@ -401,86 +211,1579 @@ TEST_CASE("Vector - push_back", "[Vector][push_back]")
 	}
 }
 
-TEST_CASE("Vector - noexcept")
+TEST_CASE("Vector - capacity", "[Vector][capacity]")
 {
-	using namespace ModernCpp;
+    using namespace ModernCpp;
 
-	std::vector<Vector<int>> vec;
-	//vec.reserve(10);
+    SECTION("default constructed vector is empty")
+    {
+        Vector<int> vec;
 
-	for(int i = 0; i < 10; ++i)
-	{
-		vec.push_back(Vector<int>{i});
-		std::cout << "-------------------\n";
-	}
-}
+        CHECK(vec.empty());
+        CHECK(vec.capacity() == 0);
+    }
 
-//////////////////////////////////////////////////////////////////////////////
-// operator ==
+    SECTION("push_back grows capacity geometrically")
+    {
+        Vector<int> vec;
+        size_t reallocations = 0;
 
-// enum class BaudRate : uint16_t
-// {
-// };
+        for (int i = 0; i < 1'000; ++i)
+        {
+            const size_t prev_capacity = vec.capacity();
+            vec.push_back(i);
+            if (vec.capacity() != prev_capacity)
+                ++reallocations;
+        }
 
-struct BaudRate
-{
-    int value;
+        CHECK(vec.size() == 1'000);
+        CHECK(vec.capacity() >= vec.size());
+        CHECK(reallocations <= 11); // log2(1000) + 1
+        CHECK(rng::equal(vec, std::views::iota(0, 1'000)));
+    }
 
-    constexpr BaudRate(int value)
-        : value(value)
+    SECTION("reserve")
     {
-        constexpr std::array<uint16_t, 4> valid_values = {100, 200, 300, 400};
+        Vector<int> vec = {1, 2, 3};
+        vec.reserve(100);
 
-        if (std::ranges::find(valid_values, value) == valid_values.end())
-            throw std::invalid_argument{"Invalid value"};
+        CHECK(vec.capacity() == 100);
+        CHECK(vec == Vector{1, 2, 3});
+
+        const int* data = vec.begin();
+        for (int i = 4; i <= 100; ++i)
+            vec.push_back(i);
+
+        CHECK(vec.begin() == data); // no reallocation
+
+        SECTION("reserving less than capacity does nothing")
+        {
+            vec.reserve(10);
+            CHECK(vec.capacity() == 100);
+        }
     }
 
-    bool operator==(const BaudRate&) const = default;
-};
+    SECTION("shrink_to_fit")
+    {
+        Vector<int> vec = {1, 2, 3};
+        vec.reserve(64);
+        vec.shrink_to_fit();
 
-consteval BaudRate operator""_br(unsigned long long value)
-{
-    // constexpr std::array<uint16_t, 4> valid_values = {100, 200, 300, 400};
-    // static_assert(std::ranges::find(valid_values, value) != valid_values.end());
+        CHECK(vec.capacity() == 3);
+        CHECK(vec == Vector{1, 2, 3});
+    }
 
-    return BaudRate{static_cast<uint16_t>(value)};
+    SECTION("push_back of own item")
+    {
+        Vector<std::string> vec = {"abc"};
+
+        for (int i = 0; i < 5; ++i)
+            vec.push_back(vec[0]);
+
+        CHECK(rng::all_of(vec, [](const auto& s) { return s == "abc"; }));
+    }
 }
 
-struct Timeout
+TEST_CASE("Vector - emplace_back", "[Vector][push_back]")
 {
-    uint16_t value;
+    using namespace ModernCpp;
 
-    bool operator==(const Timeout&) const = default;
-};
+    Vector<std::string> vec = {"abc"};
 
-Timeout operator""_ms(unsigned long long value)
-{
-    return Timeout{static_cast<uint16_t>(value)};
+    std::string& item = vec.emplace_back(3, 'x');
+
+    CHECK(item == "xxx");
+    CHECK(vec == Vector{"abc"s, "xxx"s});
 }
 
-Timeout operator""_s(unsigned long long value)
+TEST_CASE("Vector - items are constructed in place", "[Vector][constructors]")
 {
-    return Timeout{static_cast<uint16_t>(value * 1000)};
+    using ModernCpp::Vector;
+    using Helpers::String;
+
+    String::clear_stats();
+
+    SECTION("initializer list - each item is copy constructed once")
+    {
+        Vector<String> vec = {"one", "two", "three"};
+
+        CHECK(String::constructed_count() == 3);
+        CHECK(String::copy_constructed_count() == 3);
+        CHECK(String::copy_assigned_count() == 0);
+    }
+
+    SECTION("copy constructor")
+    {
+        const Vector<String> vec = {"one", "two", "three"};
+        String::clear_stats();
+
+        Vector<String> backup = vec;
+
+        CHECK(String::constructed_count() == 0);
+        CHECK(String::copy_constructed_count() == 3);
+        CHECK(String::copy_assigned_count() == 0);
+    }
+
+    SECTION("push_back into reserved storage")
+    {
+        Vector<String> vec;
+        vec.reserve(2);
+
+        String str = "text";
+        String::clear_stats();
+
+        vec.push_back(str);
+        vec.emplace_back("other");
+
+        CHECK(String::constructed_count() == 1);
+        CHECK(String::copy_constructed_count() == 1);
+        CHECK(String::copy_assigned_count() == 0);
+    }
+
+    SECTION("copy assignment reuses storage")
+    {
+        const Vector<String> source = {"a", "b"};
+        Vector<String> target = {"x", "y", "z"};
+        String::clear_stats();
+
+        target = source;
+
+        CHECK(target.size() == 2);
+        CHECK(String::copy_assigned_count() == 2);
+        CHECK(String::copy_constructed_count() == 0);
+        CHECK(String::constructed_count() == 0);
+    }
 }
 
-// void connect(int rate, int timeout)
-// {}
+namespace
+{
+    class TrackingResource : public std::pmr::memory_resource
+    {
+    public:
+        size_t allocations{};
+        size_t deallocations{};
 
-void connect(BaudRate rate, Timeout t)
+    private:
+        void* do_allocate(size_t bytes, size_t alignment) override
+        {
+            ++allocations;
+            return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+        }
+
+        void do_deallocate(void* ptr, size_t bytes, size_t alignment) override
+        {
+            ++deallocations;
+            std::pmr::new_delete_resource()->deallocate(ptr, bytes, alignment);
+        }
+
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+        {
+            return this == &other;
+        }
+    };
+} // namespace
+
+TEST_CASE("Vector - allocators", "[Vector][allocators]")
 {
-    if (t == Timeout{2000})
+    TrackingResource resource;
+
+    SECTION("memory is allocated from memory resource")
     {
-        std::cout << "Waiting 2s...\n";
+        {
+            ModernCpp::pmr::Vector<int> vec({1, 2, 3}, &resource);
+            vec.push_back(4);
+
+            CHECK(vec.get_allocator().resource() == &resource);
+            CHECK(rng::equal(vec, std::vector{1, 2, 3, 4}));
+            CHECK(resource.allocations == 2);
+        }
+
+        CHECK(resource.deallocations == resource.allocations);
+    }
+
+    SECTION("allocator is passed to items - uses-allocator construction")
+    {
+        ModernCpp::pmr::Vector<std::pmr::string> vec(&resource);
+        vec.emplace_back("a text long enough to be allocated on the heap");
+
+        CHECK(vec[0].get_allocator().resource() == &resource);
+    }
+
+    SECTION("copy constructor uses default resource")
+    {
+        ModernCpp::pmr::Vector<int> vec({1, 2, 3}, &resource);
+        ModernCpp::pmr::Vector<int> backup = vec;
+
+        CHECK(backup.get_allocator().resource() == std::pmr::get_default_resource());
+        CHECK(backup == vec);
+    }
+
+    SECTION("move constructor steals buffer and resource")
+    {
+        ModernCpp::pmr::Vector<int> vec({1, 2, 3}, &resource);
+        const int* data = vec.begin();
+
+        ModernCpp::pmr::Vector<int> target = std::move(vec);
+
+        CHECK(target.get_allocator().resource() == &resource);
+        CHECK(target.begin() == data);
+        CHECK(resource.allocations == 1);
+    }
+
+    SECTION("move assignment")
+    {
+        ModernCpp::pmr::Vector<int> vec({1, 2, 3}, &resource);
+
+        SECTION("equal resources - buffer is stolen")
+        {
+            ModernCpp::pmr::Vector<int> target(&resource);
+            const int* data = vec.begin();
+
+            target = std::move(vec);
+
+            CHECK(target.begin() == data);
+        }
+
+        SECTION("unequal resources - items are moved into target's memory")
+        {
+            TrackingResource other_resource;
+            ModernCpp::pmr::Vector<int> target({7, 8}, &other_resource);
+
+            target = std::move(vec);
+
+            CHECK(target.get_allocator().resource() == &other_resource);
+            CHECK(rng::equal(target, std::vector{1, 2, 3}));
+            CHECK(other_resource.allocations == 2);
+        }
+    }
+
+    SECTION("swap with equal resources")
+    {
+        ModernCpp::pmr::Vector<int> vec_1({1, 2, 3}, &resource);
+        ModernCpp::pmr::Vector<int> vec_2({4, 5}, &resource);
+
+        vec_1.swap(vec_2);
+
+        CHECK(rng::equal(vec_1, std::vector{4, 5}));
+        CHECK(rng::equal(vec_2, std::vector{1, 2, 3}));
     }
 }
 
-TEST_CASE("using strong typing")
+namespace
 {
-    int br = 100;
-    int timeout = 2000;
+    struct Pixel
+    {
+        uint8_t r, g, b, a;
 
-    connect(BaudRate{100}, Timeout{2000});
-    connect(200_br, 2000_ms);
-    connect(100_br, 2_s);
-    // connect(1000_br, 2_s);
-}
\ No newline at end of file
+        bool operator==(const Pixel&) const = default;
+    };
+
+    struct ThrowingMove
+    {
+        inline static int copy_count{};
+
+        std::string value;
+
+        ThrowingMove(std::string v)
+            : value{std::move(v)}
+        {
+        }
+
+        ThrowingMove(const ThrowingMove& other)
+            : value{other.value}
+        {
+            ++copy_count;
+        }
+
+        ThrowingMove(ThrowingMove&& other) noexcept(false)
+            : value{std::move(other.value)}
+        {
+        }
+    };
+} // namespace
+
+template <>
+struct ModernCpp::is_trivially_equality_comparable<Pixel> : std::true_type
+{
+};
+
+TEST_CASE("Vector - trivially copyable items", "[Vector][trivial]")
+{
+    using namespace ModernCpp;
+
+    SECTION("copy & equality of ints")
+    {
+        Vector<int> vec = {1, 2, 3, 4};
+        Vector<int> backup = vec;
+
+        CHECK(backup == vec);
+
+        backup[3] = 5;
+        CHECK(backup != vec);
+
+        backup = Vector{7, 8};
+        CHECK(backup == Vector{7, 8});
+        CHECK(backup != Vector{7});
+    }
+
+    SECTION("relocation on growth")
+    {
+        Vector<Pixel> pixels = {{1, 2, 3, 4}};
+        for (uint8_t i = 0; i < 100; ++i)
+            pixels.push_back(Pixel{i, i, i, i});
+
+        CHECK(pixels.size() == 101);
+        CHECK(pixels[0] == Pixel{1, 2, 3, 4});
+        CHECK(pixels[100] == Pixel{99, 99, 99, 99});
+        CHECK(pixels == Vector<Pixel>(pixels));
+    }
+
+    SECTION("floating point items are compared by value")
+    {
+        CHECK(Vector{0.0, 1.0} == Vector{-0.0, 1.0});
+
+        const double nan = std::numeric_limits<double>::quiet_NaN();
+        const Vector<double> vec = {nan};
+        CHECK(vec != vec);
+    }
+
+    SECTION("move_if_noexcept semantics for other types")
+    {
+        Vector<ThrowingMove> vec;
+        vec.emplace_back("a");
+        ThrowingMove::copy_count = 0;
+
+        vec.emplace_back("b"); // growth - move may throw so items are copied
+
+        CHECK(ThrowingMove::copy_count == 1);
+        CHECK(vec[0].value == "a");
+    }
+
+    SECTION("move-only items are moved")
+    {
+        Vector<std::unique_ptr<int>> vec;
+        for (int i = 0; i < 10; ++i)
+            vec.push_back(std::make_unique<int>(i));
+
+        CHECK(*vec[9] == 9);
+    }
+}
+
+TEST_CASE("Vector - tracing policy", "[Vector][tracing]")
+{
+    using namespace ModernCpp;
+
+    SECTION("default policy adds no state")
+    {
+        static_assert(sizeof(Vector<int>) == sizeof(size_t) * 2 + sizeof(int*));
+    }
+
+    SECTION("lifecycle events are recorded")
+    {
+        using Tracing = BufferedTracing<16>;
+        using TracedVector = Vector<int, std::allocator<int>, Tracing>;
+
+        Tracing::clear();
+        {
+            TracedVector vec = {1, 2, 3};
+            TracedVector backup = vec;
+            vec.push_back(4);
+            TracedVector target = std::move(vec);
+        }
+
+        REQUIRE(Tracing::size() == 7);
+
+        CHECK(Tracing::record(0).event == VectorEvent::constructed);
+        CHECK(Tracing::record(0).size == 3);
+        CHECK(Tracing::record(1).event == VectorEvent::copy_constructed);
+        CHECK(Tracing::record(2).event == VectorEvent::reallocated);
+        CHECK(Tracing::record(2).capacity == 6);
+        CHECK(Tracing::record(3).event == VectorEvent::move_constructed);
+        CHECK(Tracing::record(3).size == 4);
+        CHECK(Tracing::record(6).event == VectorEvent::destroyed);
+
+        Tracing::dump();
+    }
+
+    SECTION("ring buffer keeps last events")
+    {
+        using Tracing = BufferedTracing<4>;
+
+        Tracing::clear();
+        for (size_t i = 0; i < 10; ++i)
+            Tracing::trace(VectorEvent::constructed, nullptr, i, i);
+
+        CHECK(Tracing::count() == 10);
+        CHECK(Tracing::size() == 4);
+        CHECK(Tracing::record(0).size == 6);
+        CHECK(Tracing::record(3).size == 9);
+    }
+
+    SECTION("records are not torn when traced from many threads")
+    {
+        using Tracing = BufferedTracing<8>; // small ring - writers wrap around onto slots being read
+
+        Tracing::clear();
+        size_t torn = 0;
+        {
+            std::vector<std::jthread> writers;
+            for (size_t id = 1; id <= 4; ++id)
+            {
+                writers.emplace_back([id] {
+                    for (size_t i = 0; i < 20'000; ++i)
+                        Tracing::trace(VectorEvent::constructed, reinterpret_cast<const void*>(id), id * i, id * i);
+                });
+            }
+
+            // every field of a record is written by the same thread
+            for (int round = 0; round < 2'000; ++round)
+            {
+                for (size_t i = 0; i < Tracing::size(); ++i)
+                {
+                    const auto r = Tracing::record(i);
+                    const auto id = reinterpret_cast<uintptr_t>(r.vector);
+                    if (r.size != r.capacity || id > 4 || (id != 0 && r.size % id != 0))
+                        ++torn;
+                }
+            }
+        }
+
+        CHECK(torn == 0);
+        CHECK(Tracing::count() == 80'000);
+    }
+}
+
+TEST_CASE("Vector - ranges", "[Vector][ranges]")
+{
+    using namespace ModernCpp;
+
+    using Tracing = BufferedTracing<64>;
+    using TracedVector = Vector<int, std::allocator<int>, Tracing>;
+
+    const auto reallocations = [] {
+        return rng::count_if(std::views::iota(size_t{0}, Tracing::size()),
+            [](size_t i) { return Tracing::record(i).event == VectorEvent::reallocated; });
+    };
+
+    Tracing::clear();
+
+    SECTION("constructed from sized range - one allocation")
+    {
+        TracedVector vec(from_range, std::views::iota(0, 100));
+
+        CHECK(vec.size() == 100);
+        CHECK(vec.capacity() == 100);
+        CHECK(vec[99] == 99);
+        CHECK(reallocations() == 1);
+    }
+
+    SECTION("constructed from other containers")
+    {
+        const std::vector<std::string> words = {"one", "two", "three"};
+        Vector<std::string> vec(from_range, words);
+        CHECK(rng::equal(vec, words));
+
+        Vector<std::unique_ptr<int>> pointers(from_range, std::views::iota(0, 3) | std::views::transform([](int x) { return std::make_unique<int>(x); }));
+        CHECK(pointers.size() == 3);
+        CHECK(*pointers[2] == 2);
+    }
+
+    SECTION("constructed from unsized pipeline - geometric growth")
+    {
+        auto squares = std::views::iota(1)
+            | std::views::filter([](int x) { return x > 3; })
+            | std::views::transform([](int x) { return x * x; })
+            | std::views::take(100);
+
+        TracedVector vec(from_range, squares);
+
+        CHECK(vec.size() == 100);
+        CHECK(vec[0] == 16);
+        CHECK(reallocations() <= 8);
+    }
+
+    SECTION("append_range")
+    {
+        TracedVector vec = {1, 2, 3};
+
+        vec.append_range(std::array{4, 5, 6});
+        CHECK(rng::equal(vec, std::array{1, 2, 3, 4, 5, 6}));
+        CHECK(vec.capacity() == 6);
+
+        SECTION("own items")
+        {
+            vec.append_range(vec);
+            CHECK(rng::equal(vec, std::array{1, 2, 3, 4, 5, 6, 1, 2, 3, 4, 5, 6}));
+        }
+
+        SECTION("within capacity - no reallocation")
+        {
+            vec.reserve(20);
+            Tracing::clear();
+
+            vec.append_range(std::views::iota(7, 21));
+            CHECK(vec.size() == 20);
+            CHECK(reallocations() == 0);
+        }
+    }
+
+    SECTION("insert_range")
+    {
+        Vector<std::string> vec = {"one", "four"};
+
+        auto it = vec.insert_range(vec.begin() + 1, std::vector<std::string>{"two", "three"});
+        CHECK(*it == "two");
+        CHECK(rng::equal(vec, std::vector<std::string>{"one", "two", "three", "four"}));
+
+        it = vec.insert_range(vec.end(), std::views::single("five"s));
+        CHECK(*it == "five");
+
+        it = vec.insert_range(vec.begin(), std::views::empty<std::string>);
+        CHECK(it == vec.begin());
+        CHECK(vec.size() == 5);
+    }
+}
+
+TEST_CASE("Vector - erase_if & filter_into", "[Vector][erase_if]")
+{
+    using namespace ModernCpp;
+
+    const auto is_even = [](int x) { return x % 2 == 0; };
+
+    Vector<int> vec;
+    for (int i = 0; i < 10; ++i)
+        vec.push_back(i);
+
+    SECTION("erase_if")
+    {
+        const size_t capacity = vec.capacity();
+
+        CHECK(vec.erase_if(is_even) == 5);
+        CHECK(rng::equal(vec, std::array{1, 3, 5, 7, 9}));
+        CHECK(vec.capacity() == capacity);
+
+        CHECK(vec.erase_if(is_even) == 0);
+        CHECK(vec.erase_if([](int) { return true; }) == 5);
+        CHECK(vec.empty());
+    }
+
+    SECTION("filter_into")
+    {
+        Vector<int> evens;
+        vec.filter_into(evens, is_even);
+
+        CHECK(rng::equal(evens, std::array{0, 2, 4, 6, 8}));
+        CHECK(vec.size() == 10);
+    }
+
+    SECTION("non-trivial items")
+    {
+        Vector<std::string> words = {"one", "two", "three", "four", "five"};
+        const auto is_short = [](const std::string& s) { return s.size() <= 3; };
+
+        Vector<std::string> short_words;
+        words.filter_into(short_words, is_short);
+        CHECK(short_words == Vector<std::string>{"one", "two"});
+
+        CHECK(words.erase_if(is_short) == 2);
+        CHECK(words == Vector<std::string>{"three", "four", "five"});
+    }
+
+    SECTION("clear")
+    {
+        vec.clear();
+        CHECK(vec.empty());
+        CHECK(vec.capacity() >= 10);
+    }
+}
+
+TEST_CASE("Vector<bool> - bit-packed", "[Vector][bool]")
+{
+    using namespace ModernCpp;
+
+    using Bits = Vector<bool>;
+    static_assert(std::random_access_iterator<Bits::iterator>);
+    static_assert(std::random_access_iterator<Bits::const_iterator>);
+    static_assert(std::indirectly_writable<Bits::iterator, bool>);
+
+    // 130 bits - the last word is partially used
+    Bits bits(130);
+    for (const size_t i : {0, 3, 63, 64, 127, 129})
+        bits[i] = true;
+
+    SECTION("flags are packed into words")
+    {
+        CHECK(bits.size() == 130);
+        CHECK(bits.capacity() == 192);
+        CHECK(bits.words()[0] == ((1ull << 0) | (1ull << 3) | (1ull << 63)));
+        CHECK(bits.words()[2] == 0b10);
+
+        CHECK(bits[3]);
+        CHECK(not bits[4]);
+    }
+
+    SECTION("proxy reference")
+    {
+        bits[4] = bits[3];
+        CHECK(bits[4]);
+
+        bits[3].flip();
+        CHECK(not bits[3]);
+
+        swap(bits[0], bits[1]);
+        CHECK(not bits[0]);
+        CHECK(bits[1]);
+    }
+
+    SECTION("count & find")
+    {
+        CHECK(bits.count() == 6);
+        CHECK(bits.any());
+
+        std::vector<size_t> set_bits;
+        for (size_t i = bits.find_first(); i != Bits::npos; i = bits.find_next(i))
+            set_bits.push_back(i);
+        CHECK(set_bits == std::vector<size_t>{0, 3, 63, 64, 127, 129});
+
+        CHECK(bits.find_next(129) == Bits::npos);
+        CHECK(Bits(70).find_first() == Bits::npos);
+    }
+
+    SECTION("bitwise operations keep unused bits of last word clear")
+    {
+        const Bits inverted = ~bits;
+        CHECK(inverted.count() == 124);
+        CHECK(inverted.words()[2] == 0b01);
+
+        CHECK((bits | inverted).count() == 130);
+        CHECK((bits & inverted).count() == 0);
+        CHECK((bits ^ inverted) == Bits(130, true));
+        CHECK(Bits(130, true).count() == 130);
+
+        CHECK_THROWS_AS(bits &= Bits(129), std::invalid_argument);
+    }
+
+    SECTION("bitwise operators move results - words of the left operand are copied once")
+    {
+        using Tracing = BufferedTracing<64>;
+        using TracedBits = Vector<bool, std::allocator<bool>, Tracing>;
+
+        const TracedBits x(130, true), y(130);
+        const auto copies = [] {
+            return static_cast<size_t>(rng::count_if(std::views::iota(size_t{0}, Tracing::size()),
+                [](size_t i) { return Tracing::record(i).event == VectorEvent::copy_constructed; }));
+        };
+
+        Tracing::clear();
+        const TracedBits result = ~(((x & y) | y) ^ x);
+        CHECK(copies() == 1);
+        CHECK(result.count() == 0);
+    }
+
+    SECTION("push_back across word boundary")
+    {
+        Bits flags;
+        for (int i = 0; i < 200; ++i)
+            flags.push_back(i % 3 == 0);
+
+        CHECK(flags.size() == 200);
+        CHECK(flags.count() == 67);
+        CHECK(flags[198]);
+        CHECK(not flags[199]);
+    }
+
+    SECTION("iterators & algorithms")
+    {
+        CHECK(rng::count(bits, true) == 6);
+
+        const Bits pattern = {true, false, true, true};
+        CHECK(rng::equal(pattern, std::array{true, false, true, true}));
+
+        rng::fill(bits, true);
+        CHECK(bits.count() == 130);
+    }
+
+    SECTION("allocator is rebound to words")
+    {
+        TrackingResource resource;
+        pmr::Vector<bool> flags(1'000, true, &resource);
+
+        CHECK(flags.count() == 1'000);
+        CHECK(flags.get_allocator().resource() == &resource);
+        CHECK(resource.allocations == 1);
+    }
+}
+
+TEST_CASE("Vector - parallel bulk operations", "[Vector][parallel]")
+{
+    using namespace ModernCpp;
+
+    // threshold is lowered, so small vectors are processed by many threads
+    const Parallel policy{.threads = 4, .serial_threshold = 0};
+
+    Vector<int> source;
+    for (int i = 0; i < 1'003; ++i)
+        source.push_back(i);
+
+    SECTION("copy constructor")
+    {
+        Vector<int> copy(source, policy);
+        CHECK(copy == source);
+
+        Vector<std::string> words = {"one", "two", "three", "four", "five"};
+        Vector<std::string> words_copy(words, policy);
+        CHECK(words_copy == words);
+    }
+
+    SECTION("assign")
+    {
+        Vector<int> target = {1, 2, 3};
+        target.assign(source, policy);
+        CHECK(target == source);
+
+        SECTION("into larger vector")
+        {
+            Vector<int> small = {1, 2};
+            target.assign(small, policy);
+            CHECK(target == small);
+            CHECK(target.capacity() >= source.size());
+        }
+
+        SECTION("of strings into partially filled vector")
+        {
+            Vector<std::string> words = {"a", "b", "c", "d", "e", "f", "g"};
+            Vector<std::string> text;
+            text.reserve(10);
+            text.push_back("x");
+
+            text.assign(words, policy);
+            CHECK(text == words);
+        }
+    }
+
+    SECTION("equal")
+    {
+        Vector<int> copy = source;
+        CHECK(copy.equal(source, policy));
+
+        copy[777] = -1;
+        CHECK(not copy.equal(source, policy));
+        CHECK(not copy.equal(Vector<int>{1, 2}, policy));
+    }
+
+    SECTION("fill")
+    {
+        source.fill(42, policy);
+        CHECK(rng::all_of(source, [](int x) { return x == 42; }));
+
+        source.fill(7);
+        CHECK(rng::all_of(source, [](int x) { return x == 7; }));
+    }
+
+    SECTION("exception in one chunk destroys items constructed by others")
+    {
+        static std::atomic<int> alive = 0;
+        static bool copy_fails = false;
+
+        struct Item
+        {
+            int value;
+
+            Item(int v)
+                : value{v}
+            {
+                ++alive;
+            }
+
+            Item(const Item& other)
+                : value{other.value}
+            {
+                if (copy_fails && value == 500)
+                    throw std::runtime_error{"copy failed"};
+                ++alive;
+            }
+
+            ~Item()
+            {
+                --alive;
+            }
+        };
+
+        {
+            Vector<Item> items;
+            for (int i = 0; i < 1'000; ++i)
+                items.emplace_back(i);
+
+            alive = 0;
+            copy_fails = true;
+            CHECK_THROWS_AS((Vector<Item>(items, policy)), std::runtime_error);
+            copy_fails = false;
+            CHECK(alive == 0);
+        }
+    }
+}
+
+TEST_CASE("SmallVector", "[SmallVector]")
+{
+    using ModernCpp::SmallVector;
+
+    SmallVector<std::string, 4> vec = {"one", "two", "three"};
+
+    SECTION("inline state")
+    {
+        CHECK(vec.is_inline());
+        CHECK(vec.size() == 3);
+        CHECK(vec.capacity() == 4);
+
+        vec.push_back("four");
+        CHECK(vec.is_inline());
+    }
+
+    SECTION("spilled to heap when growing past N")
+    {
+        for (const auto* str : {"four", "five", "six"})
+            vec.push_back(str);
+
+        CHECK(not vec.is_inline());
+        CHECK(vec.capacity() >= 6);
+        CHECK(rng::equal(vec, std::vector<std::string>{"one", "two", "three", "four", "five", "six"}));
+
+        SECTION("push_back of own item")
+        {
+            vec.push_back(vec[0]);
+            CHECK(vec[6] == "one");
+        }
+    }
+
+    SECTION("reserve")
+    {
+        vec.reserve(3);
+        CHECK(vec.is_inline());
+
+        vec.reserve(10);
+        CHECK(not vec.is_inline());
+        CHECK(vec == SmallVector<std::string, 4>{"one", "two", "three"});
+    }
+
+    SECTION("indexing & iterators")
+    {
+        vec[1] = "TWO";
+        CHECK(*(vec.begin() + 1) == "TWO");
+        CHECK(vec.cend() - vec.cbegin() == 3);
+    }
+
+    SECTION("copy")
+    {
+        SmallVector<std::string, 4> big = {"a", "b", "c", "d", "e", "f"};
+
+        SmallVector<std::string, 4> inline_copy = vec;
+        SmallVector<std::string, 4> heap_copy = big;
+
+        CHECK(inline_copy == vec);
+        CHECK(inline_copy.is_inline());
+        CHECK(heap_copy == big);
+        CHECK(not heap_copy.is_inline());
+
+        inline_copy = big;
+        CHECK(inline_copy == big);
+        heap_copy = vec;
+        CHECK(heap_copy == vec);
+    }
+
+    SECTION("move")
+    {
+        SECTION("inline items are moved")
+        {
+            SmallVector<std::string, 4> target = std::move(vec);
+
+            CHECK(target == SmallVector<std::string, 4>{"one", "two", "three"});
+            CHECK(target.is_inline());
+            CHECK(vec.size() == 0);
+        }
+
+        SECTION("heap buffer is stolen")
+        {
+            SmallVector<std::string, 4> big = {"a", "b", "c", "d", "e", "f"};
+            const std::string* data = big.begin();
+
+            SmallVector<std::string, 4> target;
+            target = std::move(big);
+
+            CHECK(target.begin() == data);
+            CHECK(big.size() == 0);
+            CHECK(big.is_inline());
+        }
+    }
+
+    SECTION("swap")
+    {
+        SmallVector<std::string, 4> big = {"a", "b", "c", "d", "e", "f"};
+
+        vec.swap(big);
+
+        CHECK(vec == SmallVector<std::string, 4>{"a", "b", "c", "d", "e", "f"});
+        CHECK(big == SmallVector<std::string, 4>{"one", "two", "three"});
+        CHECK(big.is_inline());
+    }
+
+    SECTION("exception in constructor after spill to heap destroys items & releases buffer")
+    {
+        static int alive = 0;
+        static int constructions_left = 0; // next construction throws when it drops to zero
+
+        struct Item
+        {
+            Item()
+            {
+                count_construction();
+            }
+
+            Item(const Item&)
+            {
+                count_construction();
+            }
+
+            ~Item()
+            {
+                --alive;
+            }
+
+            static void count_construction()
+            {
+                if (--constructions_left == 0)
+                    throw std::runtime_error{"construction failed"};
+                ++alive;
+            }
+        };
+
+        constructions_left = 1'000;
+        {
+            const SmallVector<Item, 2> source(6);
+            alive = 0;
+
+            constructions_left = 5;
+            CHECK_THROWS_AS((SmallVector<Item, 2>(source)), std::runtime_error);
+            CHECK(alive == 0);
+
+            constructions_left = 4;
+            CHECK_THROWS_AS((SmallVector<Item, 2>(6)), std::runtime_error);
+            CHECK(alive == 0);
+
+            constructions_left = 1'000;
+            const Item a, b, c;
+            alive = 0;
+            constructions_left = 3;
+            CHECK_THROWS_AS((SmallVector<Item, 2>{a, b, c}), std::runtime_error);
+            CHECK(alive == 0);
+
+            constructions_left = 1'000;
+        }
+    }
+}
+
+TEST_CASE("Vector - noexcept")
+{
+	using namespace ModernCpp;
+
+	std::vector<Vector<int>> vec;
+	//vec.reserve(10);
+
+	for(int i = 0; i < 10; ++i)
+	{
+		vec.push_back(Vector<int>{i});
+		std::cout << "-------------------\n";
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// operator ==
+
+// enum class BaudRate : uint16_t
+// {
+// };
+
+struct BaudRate
+{
+    int value;
+
+    constexpr BaudRate(int value)
+        : value(value)
+    {
+        constexpr std::array<uint16_t, 4> valid_values = {100, 200, 300, 400};
+
+        if (std::ranges::find(valid_values, value) == valid_values.end())
+            throw std::invalid_argument{"Invalid value"};
+    }
+
+    bool operator==(const BaudRate&) const = default;
+};
+
+consteval BaudRate operator""_br(unsigned long long value)
+{
+    // constexpr std::array<uint16_t, 4> valid_values = {100, 200, 300, 400};
+    // static_assert(std::ranges::find(valid_values, value) != valid_values.end());
+
+    return BaudRate{static_cast<uint16_t>(value)};
+}
+
+struct Timeout
+{
+    uint16_t value;
+
+    bool operator==(const Timeout&) const = default;
+};
+
+Timeout operator""_ms(unsigned long long value)
+{
+    return Timeout{static_cast<uint16_t>(value)};
+}
+
+Timeout operator""_s(unsigned long long value)
+{
+    return Timeout{static_cast<uint16_t>(value * 1000)};
+}
+
+// void connect(int rate, int timeout)
+// {}
+
+void connect(BaudRate rate, Timeout t)
+{
+    if (t == Timeout{2000})
+    {
+        std::cout << "Waiting 2s...\n";
+    }
+}
+
+TEST_CASE("using strong typing")
+{
+    int br = 100;
+    int timeout = 2000;
+
+    connect(BaudRate{100}, Timeout{2000});
+    connect(200_br, 2000_ms);
+    connect(100_br, 2_s);
+    // connect(1000_br, 2_s);
+}
+TEST_CASE("SegmentedVector", "[SegmentedVector]")
+{
+    using ModernCpp::SegmentedVector;
+
+    using Vector = SegmentedVector<int, 64>;
+    static_assert(Vector::segment_capacity == 16);
+    static_assert(std::random_access_iterator<Vector::iterator>);
+    static_assert(std::random_access_iterator<Vector::const_iterator>);
+
+    Vector vec;
+    for (int i = 0; i < 100; ++i)
+        vec.push_back(i);
+
+    SECTION("items are stored in segments")
+    {
+        CHECK(vec.size() == 100);
+        CHECK(vec.capacity() == 112);
+        CHECK(vec[0] == 0);
+        CHECK(vec[16] == 16);
+        CHECK(vec[99] == 99);
+    }
+
+    SECTION("push_back does not move existing items")
+    {
+        const int* first = &vec[0];
+        const int* last = &vec[99];
+
+        for (int i = 100; i < 10'000; ++i)
+            vec.push_back(i);
+
+        CHECK(first == &vec[0]);
+        CHECK(last == &vec[99]);
+        CHECK(*last == 99);
+    }
+
+    SECTION("random access iterators across segments")
+    {
+        auto it = vec.begin() + 15;
+        CHECK(*it == 15);
+        CHECK(*++it == 16);
+        CHECK(it[20] == 36);
+        CHECK(vec.end() - vec.begin() == 100);
+
+        CHECK(rng::equal(vec, std::views::iota(0, 100)));
+        CHECK(rng::binary_search(vec, 57));
+
+        rng::reverse(vec);
+        CHECK(vec[0] == 99);
+        rng::sort(vec);
+        CHECK(vec[99] == 99);
+    }
+
+    SECTION("copy & move")
+    {
+        Vector copy = vec;
+        CHECK(copy == vec);
+
+        copy[50] = -1;
+        CHECK(copy != vec);
+
+        Vector target = std::move(copy);
+        CHECK(target.size() == 100);
+        CHECK(copy.size() == 0);
+
+        target = vec;
+        CHECK(target == vec);
+    }
+
+    SECTION("reserve & shrink_to_fit")
+    {
+        vec.reserve(1'000);
+        CHECK(vec.capacity() == 1'008);
+
+        vec.shrink_to_fit();
+        CHECK(vec.capacity() == 112);
+    }
+
+    SECTION("non-trivial items")
+    {
+        SegmentedVector<std::string, 128> words = {"one", "two", "three"};
+        for (int i = 0; i < 100; ++i)
+            words.emplace_back(20, 'a' + i % 26);
+
+        SegmentedVector<std::string, 128> copy = words;
+        CHECK(copy == words);
+        CHECK(copy[102] == std::string(20, 'a' + 99 % 26));
+    }
+}
+
+namespace
+{
+    // unique file in temp directory - removed at the end of test
+    class TempFile
+    {
+    public:
+        TempFile()
+            : path_{std::filesystem::temp_directory_path() / ("mmap_vector_test_" + std::to_string(counter_++) + ".bin")}
+        {
+            std::filesystem::remove(path_);
+        }
+
+        TempFile(const TempFile&) = delete;
+        TempFile& operator=(const TempFile&) = delete;
+
+        ~TempFile()
+        {
+            std::filesystem::remove(path_);
+        }
+
+        const std::filesystem::path& path() const noexcept
+        {
+            return path_;
+        }
+
+    private:
+        inline static std::atomic<int> counter_{};
+        std::filesystem::path path_;
+    };
+} // namespace
+
+TEST_CASE("MmapVector", "[MmapVector]")
+{
+    using ModernCpp::MmapVector;
+
+    TempFile file;
+
+    SECTION("new file is created empty")
+    {
+        MmapVector<int> vec(file.path());
+
+        CHECK(vec.empty());
+        CHECK(vec.capacity() == 0);
+        CHECK(std::filesystem::exists(file.path()));
+    }
+
+    SECTION("items are written to file")
+    {
+        {
+            MmapVector<int> vec(file.path());
+            for (int i = 0; i < 10'000; ++i)
+                vec.push_back(i);
+
+            CHECK(vec.size() == 10'000);
+            CHECK(vec.capacity() >= 10'000);
+            CHECK(vec[9'999] == 9'999);
+        }
+
+        CHECK(std::filesystem::file_size(file.path()) == 10'000 * sizeof(int));
+
+        SECTION("file is opened read-only")
+        {
+            const MmapVector<const int> vec(file.path());
+
+            CHECK(vec.size() == 10'000);
+            CHECK(rng::equal(vec, std::views::iota(0, 10'000)));
+        }
+
+        SECTION("file is opened for append")
+        {
+            {
+                MmapVector<int> vec(file.path());
+                vec.push_back(vec[0]);
+                vec[1] = -1;
+                vec.sync();
+            }
+
+            MmapVector<const int> vec(file.path());
+            CHECK(vec.size() == 10'001);
+            CHECK(vec[1] == -1);
+            CHECK(vec[10'000] == 0);
+        }
+    }
+
+    SECTION("doubles are stored as raw bytes")
+    {
+        {
+            std::ofstream out{file.path(), std::ios::binary};
+            const std::array data = {0.5, 1.5, 2.5};
+            out.write(reinterpret_cast<const char*>(data.data()), sizeof(data));
+        }
+
+        MmapVector<double> vec(file.path());
+        CHECK(rng::equal(vec, std::array{0.5, 1.5, 2.5}));
+
+        vec.resize(5);
+        CHECK(vec[4] == 0.0);
+    }
+
+    SECTION("move")
+    {
+        MmapVector<int> vec(file.path());
+        vec.push_back(42);
+
+        MmapVector<int> target = std::move(vec);
+        CHECK(target.size() == 1);
+        CHECK(vec.size() == 0);
+    }
+
+    SECTION("errors")
+    {
+        CHECK_THROWS_AS(MmapVector<const int>(file.path()), std::system_error);
+
+        {
+            std::ofstream out{file.path(), std::ios::binary};
+            out << "abc";
+        }
+
+        CHECK_THROWS_AS(MmapVector<const int>(file.path()), std::runtime_error);
+    }
+}
+
+TEST_CASE("CowVector", "[CowVector]")
+{
+    using ModernCpp::CowVector;
+
+    CowVector<int> vec = {1, 2, 3};
+    const CowVector<int> snapshot = vec;
+
+    SECTION("copies share buffer")
+    {
+        CHECK(vec.is_shared());
+        CHECK(snapshot.cbegin() == std::as_const(vec).cbegin());
+        CHECK(snapshot == vec);
+    }
+
+    SECTION("read-only access does not detach")
+    {
+        const CowVector<int>& cref = vec;
+        CHECK(cref[0] == 1);
+        CHECK(rng::equal(cref, std::array{1, 2, 3}));
+        CHECK(vec.is_shared());
+    }
+
+    SECTION("mutating access detaches")
+    {
+        vec[0] = 42;
+
+        CHECK(not vec.is_shared());
+        CHECK(not snapshot.is_shared());
+        CHECK(vec[0] == 42);
+        CHECK(snapshot[0] == 1);
+    }
+
+    SECTION("push_back detaches")
+    {
+        vec.push_back(vec[2]);
+
+        CHECK(rng::equal(vec, std::array{1, 2, 3, 3}));
+        CHECK(rng::equal(snapshot, std::array{1, 2, 3}));
+    }
+
+    SECTION("push_back of item from shared buffer")
+    {
+        CowVector<std::string> words = {"one", "two"};
+        const CowVector<std::string> backup = words;
+
+        words.push_back(std::as_const(words)[0]);
+        CHECK(words[2] == "one");
+        CHECK(backup.size() == 2);
+    }
+
+    SECTION("begin detaches")
+    {
+        rng::fill(vec, 0);
+
+        CHECK(rng::equal(vec, std::array{0, 0, 0}));
+        CHECK(rng::equal(snapshot, std::array{1, 2, 3}));
+    }
+
+    SECTION("reference taken before copy is not shared with the copy")
+    {
+        CowVector<int> data = {1, 2, 3};
+        int& first = data[0];
+        auto copy = data;
+        first = 42;
+
+        CHECK(not data.is_shared());
+        CHECK(copy[0] == 1);
+        CHECK(data[0] == 42);
+    }
+
+    SECTION("iterator taken before copy is not shared with the copy")
+    {
+        CowVector<int> data = {1, 2, 3};
+        auto it = data.begin();
+        const CowVector<int> copy = data;
+        *it = 42;
+
+        CHECK(copy[0] == 1);
+        CHECK(data[0] == 42);
+    }
+
+    SECTION("buffer becomes shareable again after reallocation")
+    {
+        CowVector<int> data = {1, 2, 3};
+        data[0] = 0;
+        data.reserve(100);
+
+        const CowVector<int> copy = data;
+        CHECK(data.is_shared());
+    }
+
+    SECTION("vector filled with push_back is shared by copies")
+    {
+        CowVector<int> data;
+        for (int i = 0; i < 5; ++i)
+            data.push_back(i);
+
+        const CowVector<int> copy = data;
+        CHECK(data.is_shared());
+        CHECK(std::as_const(copy).cbegin() == std::as_const(data).cbegin());
+    }
+
+    SECTION("emplace_back growing the buffer makes it shareable again")
+    {
+        CowVector<int> data;
+        data.reserve(2);
+        data.emplace_back(1) = 10;
+        data.emplace_back(2);
+        const CowVector<int> deep_copy = data;
+        CHECK(not data.is_shared());
+
+        data.push_back(3); // reallocates - the references returned by emplace_back are invalid
+        const CowVector<int> copy = data;
+        CHECK(data.is_shared());
+        CHECK(rng::equal(copy, std::array{10, 2, 3}));
+    }
+
+    SECTION("unique buffer is modified in place")
+    {
+        CowVector<int> data = {1, 2, 3};
+        const int* items = std::as_const(data).cbegin();
+
+        data[0] = 0;
+        CHECK(std::as_const(data).cbegin() == items);
+    }
+
+    SECTION("default constructed vector")
+    {
+        CowVector<int> empty;
+        CHECK(empty.empty());
+        CHECK(empty.begin() == empty.end());
+
+        empty.push_back(1);
+        CHECK(empty.size() == 1);
+    }
+
+    SECTION("snapshots cross threads")
+    {
+        CowVector<int> data(10'000);
+        rng::fill(data, 1);
+
+        std::atomic<int> mismatches = 0;
+        {
+            std::vector<std::jthread> readers;
+            for (int i = 0; i < 4; ++i)
+            {
+                readers.emplace_back([snapshot = data, &mismatches] {
+                    for (int j = 0; j < 100; ++j)
+                    {
+                        const CowVector<int> copy = snapshot;
+                        if (std::accumulate(copy.begin(), copy.end(), 0) != 10'000)
+                            ++mismatches;
+                    }
+                });
+            }
+
+            rng::fill(data, 2); // readers hold copies - they see old values
+        }
+
+        CHECK(mismatches == 0);
+        CHECK(data[0] == 2);
+    }
+}
+
+TEST_CASE("ConcurrentAppendVector", "[ConcurrentAppendVector]")
+{
+    using ModernCpp::ConcurrentAppendVector;
+
+    SECTION("single thread")
+    {
+        ConcurrentAppendVector<std::string> vec;
+        CHECK(vec.empty());
+
+        CHECK(vec.push_back("one") == 0);
+        CHECK(vec.emplace_back(3, 'a') == 1);
+
+        const std::string* first = &vec[0];
+        for (int i = 0; i < 10'000; ++i)
+            vec.push_back(std::to_string(i));
+
+        CHECK(vec.size() == 10'002);
+        CHECK(vec[1] == "aaa");
+        CHECK(vec[10'001] == "9999");
+        CHECK(first == &vec[0]); // items are never moved
+        CHECK(std::distance(vec.begin(), vec.end()) == 10'002);
+    }
+
+    SECTION("many producers")
+    {
+        constexpr int producers_count = 4;
+        constexpr int items_per_producer = 20'000;
+
+        ConcurrentAppendVector<std::pair<int, int>> vec; // (producer, sequence number)
+        std::atomic<bool> inconsistent_prefix = false;
+        std::atomic<int> producers_done = 0;
+
+        {
+            std::vector<std::jthread> threads;
+            for (int producer = 0; producer < producers_count; ++producer)
+            {
+                threads.emplace_back([&, producer] {
+                    for (int i = 0; i < items_per_producer; ++i)
+                        vec.push_back(std::pair{producer, i});
+                    ++producers_done;
+                });
+            }
+
+            // reader - items of each producer are seen in order within the published prefix
+            threads.emplace_back([&] {
+                while (producers_done < producers_count)
+                {
+                    std::array<int, producers_count> next_sequence{};
+                    for (const auto& [producer, sequence] : vec)
+                    {
+                        if (sequence != next_sequence[producer]++)
+                            inconsistent_prefix = true;
+                    }
+                }
+            });
+        }
+
+        CHECK(not inconsistent_prefix);
+        REQUIRE(vec.size() == producers_count * items_per_producer);
+
+        std::vector<std::pair<int, int>> items(vec.begin(), vec.end());
+        rng::sort(items);
+
+        std::vector<std::pair<int, int>> expected;
+        for (int producer = 0; producer < producers_count; ++producer)
+            for (int i = 0; i < items_per_producer; ++i)
+                expected.emplace_back(producer, i);
+        CHECK(items == expected);
+    }
+
+    SECTION("reserve")
+    {
+        ConcurrentAppendVector<int> vec;
+        vec.reserve(100'000);
+        CHECK(vec.empty());
+
+        vec.push_back(1);
+        CHECK(vec[0] == 1);
+    }
+}
+
+TEST_CASE("SortedIndex", "[SortedIndex]")
+{
+    using ModernCpp::SortedIndex;
+    using ModernCpp::Vector;
+
+    SECTION("empty")
+    {
+        SortedIndex<int> index{Vector<int>{}};
+        CHECK(index.empty());
+        CHECK(index.lower_bound(42) == nullptr);
+        CHECK(not index.contains(42));
+    }
+
+    SECTION("lower_bound & contains match sorted range")
+    {
+        // all shapes of the last tree level
+        for (int n : {1, 2, 3, 7, 8, 9, 100, 1023, 1024, 1025})
+        {
+            Vector<int> keys;
+            for (int i = n - 1; i >= 0; --i)
+                keys.push_back(i * 3); // unsorted
+
+            const SortedIndex index(keys);
+            REQUIRE(index.size() == static_cast<size_t>(n));
+
+            for (int key = -1; key <= 3 * n; ++key)
+            {
+                const int* item = index.lower_bound(key);
+                const int expected = (key + 2) / 3 * 3; // smallest multiple of 3 not less than key
+
+                if (expected < 3 * n)
+                {
+                    REQUIRE(item);
+                    CHECK(*item == expected);
+                }
+                else
+                    CHECK(item == nullptr);
+
+                CHECK(index.contains(key) == (key >= 0 && key % 3 == 0 && key < 3 * n));
+            }
+        }
+    }
+
+    SECTION("duplicates")
+    {
+        const SortedIndex index(std::vector{5, 1, 5, 5, 3, 1});
+
+        CHECK(*index.lower_bound(2) == 3);
+        CHECK(*index.lower_bound(4) == 5);
+        CHECK(index.contains(5));
+        CHECK(index.lower_bound(6) == nullptr);
+    }
+
+    SECTION("batch lookups")
+    {
+        const SortedIndex index(rng::views::iota(0, 1000) | rng::views::transform([](int i) { return 2 * i; }));
+
+        std::vector<int> queries(1000 + 7); // full groups & a tail
+        std::iota(queries.begin(), queries.end(), -3);
+        std::vector<const int*> results(queries.size());
+
+        index.lower_bound(queries, results);
+
+        for (size_t i = 0; i < queries.size(); ++i)
+            CHECK(results[i] == index.lower_bound(queries[i]));
+    }
+}
@@ -0,0 +1,153 @@
+#ifndef VECTOR_TRACING_HPP
+#define VECTOR_TRACING_HPP
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string_view>
+
+namespace ModernCpp
+{
+    enum class VectorEvent : uint8_t
+    {
+        constructed,
+        copy_constructed,
+        copy_assigned,
+        move_constructed,
+        move_assigned,
+        reallocated,
+        destroyed
+    };
+
+    constexpr std::string_view to_string(VectorEvent event) noexcept
+    {
+        switch (event)
+        {
+        case VectorEvent::constructed:
+            return "constructed";
+        case VectorEvent::copy_constructed:
+            return "copy constructed";
+        case VectorEvent::copy_assigned:
+            return "copy assigned";
+        case VectorEvent::move_constructed:
+            return "move constructed";
+        case VectorEvent::move_assigned:
+            return "move assigned";
+        case VectorEvent::reallocated:
+            return "reallocated";
+        case VectorEvent::destroyed:
+            return "destroyed";
+        }
+        return "unknown";
+    }
+
+    // default tracing policy - calls are optimized away
+    struct NoTracing
+    {
+        static constexpr void trace(VectorEvent, const void*, size_t, size_t) noexcept
+        {
+        }
+    };
+
+    // tracing policy recording the last Capacity events in a static ring buffer
+    // - recording neither allocates nor locks, so it can be used from many threads
+    // - each slot is a seqlock - readers copy a record only when no writer is inside the slot, so records are never torn
+    // - when the ring wraps around onto a slot that is still being written, the newer event is dropped
+    // - records are meant to be dumped after the run
+    template <size_t Capacity = 4096>
+    class BufferedTracing
+    {
+    public:
+        struct Record
+        {
+            VectorEvent event;
+            const void* vector;
+            size_t size;
+            size_t capacity;
+        };
+
+        static void trace(VectorEvent event, const void* vector, size_t size, size_t capacity) noexcept
+        {
+            const size_t index = next_index_.fetch_add(1, std::memory_order_relaxed);
+            Slot& slot = slots_[index % Capacity];
+
+            // stamp is odd while the slot is written - it is claimed only from an even (stable) state
+            size_t stamp = slot.stamp.load(std::memory_order_relaxed);
+            if (stamp % 2 != 0 || !slot.stamp.compare_exchange_strong(stamp, stamp + 1, std::memory_order_relaxed))
+                return;
+
+            // release stores - a reader that sees any of the new fields also sees the claim (no fences, which tsan can't model)
+            slot.event.store(event, std::memory_order_release);
+            slot.vector.store(vector, std::memory_order_release);
+            slot.size.store(size, std::memory_order_release);
+            slot.capacity.store(capacity, std::memory_order_release);
+
+            slot.stamp.store(stamp + 2, std::memory_order_release);
+        }
+
+        // number of recorded events - only the last Capacity of them are kept
+        static size_t count() noexcept
+        {
+            return next_index_.load(std::memory_order_relaxed);
+        }
+
+        // copy of n-th of the kept events - 0 is the oldest one
+        static Record record(size_t n) noexcept
+        {
+            const size_t total = count();
+            const size_t first = total > Capacity ? total - Capacity : 0;
+            const Slot& slot = slots_[(first + n) % Capacity];
+
+            while (true)
+            {
+                const size_t stamp = slot.stamp.load(std::memory_order_acquire);
+                if (stamp % 2 != 0)
+                    continue; // writer is inside the slot
+
+                // acquire loads - fields are read before the stamp is checked again
+                const Record result{slot.event.load(std::memory_order_acquire), slot.vector.load(std::memory_order_acquire),
+                    slot.size.load(std::memory_order_acquire), slot.capacity.load(std::memory_order_acquire)};
+
+                if (slot.stamp.load(std::memory_order_relaxed) == stamp)
+                    return result;
+            }
+        }
+
+        static size_t size() noexcept
+        {
+            return std::min(count(), Capacity);
+        }
+
+        static void clear() noexcept
+        {
+            next_index_.store(0, std::memory_order_relaxed);
+        }
+
+        static void dump(std::ostream& out = std::cout)
+        {
+            for (size_t i = 0; i < size(); ++i)
+            {
+                const Record r = record(i);
+                out << "Vector(" << r.vector << ") " << to_string(r.event) << " - size: " << r.size << ", capacity: " << r.capacity << "\n";
+            }
+        }
+
+    private:
+        struct Slot
+        {
+            std::atomic<size_t> stamp{}; // even - record is stable, odd - record is being written
+            std::atomic<VectorEvent> event{};
+            std::atomic<const void*> vector{};
+            std::atomic<size_t> size{};
+            std::atomic<size_t> capacity{};
+        };
+
+        inline static std::array<Slot, Capacity> slots_{};
+        inline static std::atomic<size_t> next_index_{};
+    };
+} // namespace ModernCpp
+
+#endif // VECTOR_TRACING_HPP